@@ -0,0 +1,110 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+#include "Common/DialSummary.h"
+#include "Common/Log.h"
+#include "Common/Scanner.h"
+
+namespace AOC1
+{
+
+// Modulus positions dial starting on Start. Both are known at compile time, so the modulo of every rotation
+// is a multiply and shift rather than a division.
+template<uint64_t Modulus = 100, uint64_t Start = 50>
+class Dial
+{
+public:
+    static_assert(Modulus > 0 && Start < Modulus, "The dial starts on one of its positions");
+
+    static constexpr uint64_t K_START = Start;
+
+    enum class Direction 
+    {
+        Left,
+        Right
+    };
+
+    // "L45" -> Left, 45. False when the direction is neither 'L' nor 'R', the line is then no rotation
+    static bool ParseRotation(std::string_view input, Direction& direction, uint64_t& count)
+    {
+        char letter = '\0';
+        Scanner scanner(input);
+        scanner.ReadChar(letter);
+        scanner.Read(count);
+
+        if (letter == 'L') direction = Direction::Left;
+        else if (letter == 'R') direction = Direction::Right;
+        else return false;
+
+        return true;
+    }
+
+    // Same rotation, for every start position at once
+    static void Summarize(DialSummaryBuilder& builder, std::string_view input)
+    {
+        static_assert(Modulus == DialSummary::K_POSITIONS, "Summaries are for the puzzle's dial");
+
+        Direction direction;
+        uint64_t count = 0;
+        if (!ParseRotation(input, direction, count))
+        {
+            builder.TurnUp(0); // Doesn't move, but the dial is still checked for 0 after the line
+            return;
+        }
+
+        if (direction == Direction::Left) builder.TurnDown(count);
+        if (direction == Direction::Right) builder.TurnUp(count);
+    }
+
+    // Where a rotation leaves the dial. Branchless, a log's directions are as good as random : Left adds
+    // Modulus - count instead of count. The sum stays below twice the modulus so a masked subtraction wraps it,
+    // the only modulo left is the count's, out of the chain from one index to the next.
+    static constexpr uint64_t Turn(uint64_t index, Direction direction, uint64_t count)
+    {
+        count %= Modulus;
+        uint64_t left = direction == Direction::Left;
+        uint64_t next = index + count + left * (Modulus - 2 * count);
+        return next - (Modulus & (0 - static_cast<uint64_t>(next >= Modulus)));
+    }
+
+    // The password of a whole log, the rotations ending on 0, at compile time when the log is a constant
+    static constexpr uint64_t Solve(std::string_view log)
+    {
+        uint64_t index = Start;
+        uint64_t password = 0;
+        char direction = '\0';
+        uint64_t count = 0;
+        while (NextRotation(log, direction, count))
+        {
+            if (direction == 'L') index = Turn(index, Direction::Left, count);
+            if (direction == 'R') index = Turn(index, Direction::Right, count);
+            if (index == 0) password++;
+        }
+        return password;
+    }
+
+    void Rotate(std::string_view input)
+    {
+        Direction direction;
+        uint64_t count = 0;
+        if (!ParseRotation(input, direction, count)) return;
+
+        Rotate(direction, count);
+    }
+
+    void Rotate(Direction direction, uint64_t count)
+    {
+        m_Index = Turn(m_Index, direction, count);
+
+        AOC_LOG_TRACE("Rotate " << (direction == Direction::Left ? "Left " : "Right") << count % Modulus << ". New Position : " << m_Index);
+    }
+
+    uint64_t GetIndex() const { return m_Index; }
+
+private:
+    uint64_t m_Index = Start;
+};
+
+} // namespace AOC1
@@ -0,0 +1,126 @@
+#include "DialBank.h"
+
+#include <algorithm>
+#include <cassert>
+#include <numeric>
+
+#include "Common/Scanner.h"
+
+#if defined(__AVX2__)
+#define AOC_DIAL_BANK_AVX2 1
+#include <immintrin.h>
+#else
+#define AOC_DIAL_BANK_AVX2 0
+#endif
+
+namespace AOC1
+{
+
+namespace
+{
+    // The 16 bits hit counters of a block are flushed before they can wrap
+    constexpr size_t K_FLUSH_ROWS = 0xFFFF;
+
+#if AOC_DIAL_BANK_AVX2
+    constexpr size_t K_LANES = 16;
+
+    // Turns the locks [first, first + 16) through every row, their positions and hits staying in registers
+    void RotateBlock(uint16_t* indices, uint64_t* zeroHits, uint16_t const* steps, size_t lockCount, size_t rowCount, size_t first)
+    {
+        __m256i const positions = _mm256_set1_epi16(DialBank::K_POSITIONS);
+        __m256i const zero = _mm256_setzero_si256();
+
+        __m256i index = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(indices + first));
+        for (size_t row = 0; row < rowCount; row += K_FLUSH_ROWS)
+        {
+            size_t lastRow = std::min(rowCount, row + K_FLUSH_ROWS);
+            __m256i hits = zero;
+            for (size_t current = row; current < lastRow; current++)
+            {
+                __m256i step = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(steps + current * lockCount + first));
+                // index + step < 200 : the wrapped sum underflows to a larger unsigned value when it wasn't needed
+                __m256i sum = _mm256_add_epi16(index, step);
+                index = _mm256_min_epu16(sum, _mm256_sub_epi16(sum, positions));
+                hits = _mm256_sub_epi16(hits, _mm256_cmpeq_epi16(index, zero)); // cmpeq sets -1
+            }
+
+            alignas(32) uint16_t blockHits[K_LANES];
+            _mm256_store_si256(reinterpret_cast<__m256i*>(blockHits), hits);
+            for (size_t lane = 0; lane < K_LANES; lane++) zeroHits[first + lane] += blockHits[lane];
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(indices + first), index);
+    }
+#endif
+
+    void RotateLock(uint16_t* indices, uint64_t* zeroHits, uint16_t const* steps, size_t lockCount, size_t rowCount, size_t lock)
+    {
+        uint16_t index = indices[lock];
+        uint64_t hits = 0;
+        for (size_t row = 0; row < rowCount; row++)
+        {
+            index = static_cast<uint16_t>(index + steps[row * lockCount + lock]);
+            if (index >= DialBank::K_POSITIONS) index = static_cast<uint16_t>(index - DialBank::K_POSITIONS);
+            if (index == 0) hits++;
+        }
+        indices[lock] = index;
+        zeroHits[lock] += hits;
+    }
+}
+
+DialBank::DialBank(size_t lockCount, uint16_t start)
+    : m_Indices(lockCount, start)
+    , m_ZeroHits(lockCount, 0)
+{
+}
+
+uint16_t DialBank::GetStep(char direction, uint64_t count)
+{
+    uint16_t clicks = static_cast<uint16_t>(count % K_POSITIONS);
+    if (direction == 'L') return static_cast<uint16_t>((K_POSITIONS - clicks) % K_POSITIONS);
+    if (direction == 'R') return clicks;
+    return 0; // Like Dial, any other direction doesn't move the lock
+}
+
+uint16_t DialBank::GetStep(std::string_view rotation)
+{
+    char direction = '\0';
+    uint64_t count = 0;
+    Scanner scanner(rotation);
+    scanner.ReadChar(direction);
+    scanner.Read(count);
+
+    return GetStep(direction, count);
+}
+
+char const* DialBank::GetKernelName()
+{
+    return AOC_DIAL_BANK_AVX2 ? "AVX2" : "Scalar";
+}
+
+void DialBank::Rotate(std::vector<uint16_t> const& steps)
+{
+    size_t lockCount = GetLockCount();
+    if (lockCount == 0) return;
+
+    assert(steps.size() % lockCount == 0);
+    size_t rowCount = steps.size() / lockCount;
+
+    size_t lock = 0;
+#if AOC_DIAL_BANK_AVX2
+    for (; lock + K_LANES <= lockCount; lock += K_LANES)
+    {
+        RotateBlock(m_Indices.data(), m_ZeroHits.data(), steps.data(), lockCount, rowCount, lock);
+    }
+#endif
+    for (; lock < lockCount; lock++)
+    {
+        RotateLock(m_Indices.data(), m_ZeroHits.data(), steps.data(), lockCount, rowCount, lock);
+    }
+}
+
+uint64_t DialBank::GetTotalZeroHits() const
+{
+    return std::accumulate(m_ZeroHits.begin(), m_ZeroHits.end(), uint64_t(0));
+}
+
+} // namespace AOC1
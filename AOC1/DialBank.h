@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace AOC1
+{
+
+// Many of AOC1's combination locks turned side by side, each by its own rotation log, counting per lock
+// the rotations that leave it on 0. Positions are kept as a structure of arrays of 16 bits lanes,
+// so with AVX2 one instruction turns 16 locks and a block of locks stays in registers for a whole log.
+class DialBank
+{
+public:
+    static constexpr uint16_t K_POSITIONS = 100;
+
+    explicit DialBank(size_t lockCount, uint16_t start = 50);
+
+    // A rotation as the clicks it adds modulo 100 : "L45" -> 55, "R45" -> 45, any other direction -> 0
+    static uint16_t GetStep(char direction, uint64_t count);
+    static uint16_t GetStep(std::string_view rotation);
+
+    // "AVX2" or "Scalar", whichever this build compiled
+    static char const* GetKernelName();
+
+    // Applies stepCount rotations to every lock : steps holds one row of GetLockCount() steps per rotation
+    void Rotate(std::vector<uint16_t> const& steps);
+
+    size_t GetLockCount() const { return m_Indices.size(); }
+    uint16_t GetIndex(size_t lock) const { return m_Indices[lock]; }
+    void SetIndex(size_t lock, uint16_t index) { m_Indices[lock] = index; }
+    uint64_t GetZeroHits(size_t lock) const { return m_ZeroHits[lock]; }
+    uint64_t GetTotalZeroHits() const;
+
+private:
+    std::vector<uint16_t> m_Indices;
+    std::vector<uint64_t> m_ZeroHits;
+};
+
+} // namespace AOC1
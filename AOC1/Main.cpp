@@ -1,70 +1,20 @@
+#include "Dial.h"
 
-#include <cstdint>
-#include <fstream>
 #include <iostream>
-#include <sstream>
-#include <string>
+#include <string_view>
 
-class Dial
-{
-public:
-    enum class Direction 
-    {
-        Left,
-        Right
-    };
-
-    void Rotate(std::string const& input)
-    {
-        char direction;
-        uint64_t count;
-        std::istringstream stream(input);
-        stream >> direction;
-        stream >> count;
-        
-        if (direction == 'L') Rotate(Direction::Left, count);
-        if (direction == 'R') Rotate(Direction::Right, count);
-    }
-
-    void Rotate(Direction direction, uint64_t count)
-    {
-        count %= 100;
-        if (direction == Direction::Left)
-        {
-            m_Index = m_Index + 100 - count;
-            m_Index %= 100;
-        }
-        else 
-        {
-            m_Index += count;
-            m_Index %= 100;
-        }
-
-        std::cout  << "Rotate " << (direction == Direction::Left ? "Left " : "Right") << count << ". New Position : "<< m_Index << "\n";
-    }
-
-    uint64_t GetIndex() const { return m_Index; }
-
-private:
-    uint64_t m_Index = 50;
-};
+#include "Common/Day.h"
+#include "Common/DialSummary.h"
 
 int main(int argc, char** argv)
 {
     std::cout << "Begining Pasword cracking\n\n";
-    Dial dial;
-    uint64_t count = 0;
-    std::ifstream stream("input.txt");
-    std::string line;
-    while (std::getline(stream, line))
+
+    // --all-starts [<file>] : the password for each of the dial's start positions instead of 50
+    if (argc > 1 && std::string_view(argv[1]) == "--all-starts")
     {
-        dial.Rotate(line);
-        if (dial.GetIndex() == 0)
-        {
-            count++;
-        }
+        return RunAllStarts(argc > 2 ? argv[2] : "input.txt", &AOC1::Dial<>::Summarize);
     }
 
-    std::cout << "Password : " << count << "\n";
-    return 0;
-}
\ No newline at end of file
+    return RunDay("AOC1", argc, argv, "--all-starts [file]");
+}
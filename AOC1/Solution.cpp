@@ -0,0 +1,68 @@
+#include "Dial.h"
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Common/Day.h"
+#include "Common/DialSummary.h"
+#include "Common/InputFile.h"
+#include "Common/Log.h"
+#include "Common/Scanner.h"
+
+namespace AOC1
+{
+
+// The puzzle's example, solved while compiling
+static_assert(Dial<>::Solve("L68\nL30\nR48\nL5\nR60\nL55\nL1\nL99\nR14\nL82\n") == 3);
+
+class Solution : public Day
+{
+public:
+    void Parse(std::string_view input) override
+    {
+        Tokenizer lines(input);
+        std::string_view line;
+        while (lines.Next(line))
+        {
+            m_Rotations.push_back(line);
+        }
+    }
+
+    bool Reset() override
+    {
+        m_Rotations.clear();
+        return true;
+    }
+
+    std::optional<std::string> Part1() override
+    {
+        if (m_Rotations.size() > K_DIAL_ROTATIONS_PER_CHUNK)
+        {
+            return std::to_string(SummarizeRotations(m_Rotations, &Dial<>::Summarize).GetLandings(Dial<>::K_START));
+        }
+
+        Dial<> dial;
+        uint64_t count = 0;
+        for (std::string_view rotation : m_Rotations)
+        {
+            dial.Rotate(rotation);
+            if (dial.GetIndex() == 0)
+            {
+                count++;
+            }
+        }
+
+        return std::to_string(count);
+    }
+
+private:
+    std::vector<std::string_view> m_Rotations;
+};
+
+} // namespace AOC1
+
+AOC_REGISTER_DAY(AOC1, AOC1::Solution);
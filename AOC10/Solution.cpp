@@ -0,0 +1,219 @@
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Common/Day.h"
+#include "Common/InputFile.h"
+#include "Common/Log.h"
+#include "Common/Scanner.h"
+
+namespace AOC10
+{
+
+class Span
+{
+public:
+    Span(uint64_t min, uint64_t max)
+        : m_Min(min), m_Max(max)
+    {
+    }
+
+    uint64_t GetMin() const { return m_Min; }
+    uint64_t GetMax() const { return m_Max; }
+
+    bool IsFresh(uint64_t id) const
+    {
+        return id >= m_Min && id <= m_Max;
+    }
+
+    uint64_t GetOverlapSpanSize(Span const& other) const
+    {
+        uint64_t min = std::max(m_Min, other.m_Min);
+        uint64_t max = std::min(m_Max, other.m_Max);
+        return (min <= max) ? (max - min) + 1 : 0;
+    }
+
+    uint64_t GetSpanSize() const
+    {
+        // if m_Min == m_Max we still have 1 available value
+        return 1 + (m_Max - m_Min);
+    }
+
+private:
+    uint64_t m_Min;
+    uint64_t m_Max;
+};
+
+std::optional<Span> Merge(Span const& left, Span const& right)
+{
+    if (left.GetOverlapSpanSize(right) == 0) return std::nullopt;
+    uint64_t min = std::min(left.GetMin(), right.GetMin());
+    uint64_t max = std::max(left.GetMax(), right.GetMax());
+    return Span(min, max);
+}
+
+bool HasAnyOverlaps(std::vector<Span> const& spans)
+{
+    for (size_t left = 0; left < spans.size(); left++)
+    {
+        for (size_t right = 0; right < spans.size(); right++)
+        {
+            if (left == right) continue;
+
+            Span const& lspan = spans.at(left);
+            Span const& rspan = spans.at(right);
+
+            if (lspan.GetOverlapSpanSize(rspan) > 0) return true;
+        }
+    }
+
+    return false;
+}
+
+void MergeAll(std::vector<Span>& spans)
+{
+    while (HasAnyOverlaps(spans))
+    {
+        std::vector<Span> queue = spans;
+        spans.clear();
+
+        for (Span const& current : queue)
+        {
+            bool currentWasMerged = false;
+            for (Span& mergeable : spans)
+            {
+                auto result = Merge(mergeable, current);
+                if (result.has_value())
+                {
+                    mergeable = result.value();
+                    currentWasMerged = true;
+                    break;
+                }
+            }
+
+            if (!currentWasMerged)
+            {
+                spans.push_back(current);
+            }
+        }
+    }
+}
+
+class Database
+{
+public:
+    void AddSpan(uint64_t min, uint64_t max)
+    {
+        m_Spans.emplace_back(min, max);
+    }
+
+    void Clear()
+    {
+        m_Spans.clear();
+    }
+
+    bool IsFresh(uint64_t id) const
+    {
+        for (auto const& range : m_Spans)
+        {
+            if (range.IsFresh(id))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    uint64_t ComputeFreshIDCount() const
+    {
+
+        std::vector<Span> copy = m_Spans;
+        MergeAll(copy);
+        uint64_t count = 0;
+        for (Span const& span : copy)
+        {
+            count += span.GetSpanSize();
+        }
+
+        return count;
+    }
+
+    Span GetBoundingSpan() const
+    {
+        uint64_t min = std::numeric_limits<uint64_t>::max();
+        uint64_t max = std::numeric_limits<uint64_t>::min();
+        for (Span const& span : m_Spans)
+        {
+            min = std::min(min, span.GetMin());
+            max = std::max(max, span.GetMax());
+        }
+
+        return Span(min, max);
+    }
+
+private:
+    std::vector<Span> m_Spans;
+};
+
+void ReadInput(std::string_view input, Database& db, std::vector<uint64_t>& ids)
+{
+    Tokenizer lines(input);
+    std::string_view line;
+
+    // Load Database
+    while (lines.Next(line))
+    {
+        if (line.empty()) break;
+
+        Scanner scanner(line);
+        uint64_t min = 0, max = 0;
+        [[maybe_unused]] bool valid = scanner.Read(min) && scanner.Skip('-') && scanner.Read(max);
+        assert(valid);
+        db.AddSpan(min, max);
+    }
+
+    // Load Available IDs
+    while (lines.Next(line))
+    {
+        ids.push_back(ParseInteger<uint64_t>(line));
+    }
+}
+
+class Solution : public Day
+{
+public:
+    void Parse(std::string_view input) override
+    {
+        ReadInput(input, m_Database, m_IDs);
+    }
+
+    bool Reset() override
+    {
+        m_Database.Clear();
+        m_IDs.clear();
+        return true;
+    }
+
+    std::optional<std::string> Part1() override
+    {
+        AOC_LOG_DEBUG("Theoretical Max Span : " << m_Database.GetBoundingSpan().GetSpanSize());
+        return std::to_string(m_Database.ComputeFreshIDCount());
+    }
+
+private:
+    Database m_Database;
+    std::vector<uint64_t> m_IDs;
+};
+
+} // namespace AOC10
+
+AOC_REGISTER_DAY(AOC10, AOC10::Solution);
@@ -0,0 +1,155 @@
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Common/Day.h"
+#include "Common/InputFile.h"
+#include "Common/Log.h"
+#include "Common/Scanner.h"
+#include "Common/ThreadPool.h"
+
+namespace AOC11
+{
+
+struct MathProblem
+{
+public:
+    void AddVariable(uint64_t variable)
+    {
+        m_Variables.push_back(variable);
+    }
+
+    void SetOperator(char character)
+    {
+        m_Operator = character;
+    }
+
+    uint64_t GetResult() const
+    {
+        uint64_t result = m_Variables.at(0);
+        for (uint64_t index = 1; index < m_Variables.size(); index++)
+        {
+            uint64_t value = m_Variables.at(index);
+            switch (m_Operator)
+            {
+                case '+': result += value; break;
+                case '*': result *= value; break;
+                default: break;
+            }
+        }
+        return result;
+    }
+
+    friend std::ostream& operator<<(std::ostream& stream, MathProblem const& problem)
+    {
+        bool first = true;
+        for (uint64_t value : problem.m_Variables)
+        {
+            if (first) first = false;
+            else stream << " " << problem.m_Operator << " ";
+            stream << value;
+        }
+
+        return stream << " = " << problem.GetResult();
+    }
+
+private:
+    std::vector<uint64_t> m_Variables;
+    char m_Operator = 0;
+};
+
+std::vector<uint64_t> ReadVariables(std::string_view line)
+{
+    std::vector<uint64_t> result;
+
+    Scanner scanner(line);
+    uint64_t value;
+    while (scanner.ReadNext(value))
+    {
+        result.push_back(value);
+    }
+
+    return result;
+}
+
+std::vector<char> ReadOperators(std::string_view line)
+{
+    std::vector<char> result;
+
+    Scanner scanner(line);
+    char value;
+    for (scanner.SkipSpaces(); scanner.ReadChar(value); scanner.SkipSpaces())
+    {
+        result.push_back(value);
+    }
+
+    return result;
+}
+
+std::vector<MathProblem> ReadInput(std::string_view input)
+{
+    std::vector<MathProblem> problems;
+
+    Tokenizer lines(input);
+    std::string_view line;
+    while (lines.Next(line))
+    {
+        if (!lines.IsEmpty())
+        {
+            auto variables = ReadVariables(line);
+
+            if (problems.empty()) problems.resize(variables.size());
+
+            for (size_t index = 0; index < variables.size(); index++)
+            {
+                problems.at(index).AddVariable(variables.at(index));
+            }
+        }
+        else
+        {
+            auto operators = ReadOperators(line);
+            for (size_t index = 0; index < operators.size(); index++)
+            {
+                problems.at(index).SetOperator(operators.at(index));
+            }
+        }
+    }
+
+    return problems;
+}
+
+class Solution : public Day
+{
+public:
+    void Parse(std::string_view input) override
+    {
+        m_Problems = ReadInput(input);
+    }
+
+    std::optional<std::string> Part1() override
+    {
+        uint64_t total = ParallelReduce(0, m_Problems.size(), 256, uint64_t(0), [this](size_t index)
+        {
+            MathProblem const& problem = m_Problems[index];
+            AOC_LOG_TRACE(problem);
+            return problem.GetResult();
+        }, std::plus<uint64_t>());
+
+        return std::to_string(total);
+    }
+
+private:
+    std::vector<MathProblem> m_Problems;
+};
+
+} // namespace AOC11
+
+AOC_REGISTER_DAY(AOC11, AOC11::Solution);
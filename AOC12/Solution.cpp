@@ -0,0 +1,138 @@
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <cwctype>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Common/Day.h"
+#include "Common/Grid.h"
+#include "Common/InputFile.h"
+#include "Common/Log.h"
+#include "Common/Scanner.h"
+#include "Common/ThreadPool.h"
+
+namespace AOC12
+{
+
+class MathProblem
+{
+public:
+    void AddVariable(uint64_t variable)
+    {
+        m_Variables.push_back(variable);
+    }
+
+    void SetOperator(char character)
+    {
+        m_Operator = character;
+    }
+
+    uint64_t GetResult() const
+    {
+        uint64_t result = m_Variables.at(0);
+        for (uint64_t index = 1; index < m_Variables.size(); index++)
+        {
+            uint64_t value = m_Variables.at(index);
+            switch (m_Operator)
+            {
+                case '+': result += value; break;
+                case '*': result *= value; break;
+                default: break;
+            }
+        }
+        return result;
+    }
+
+    friend std::ostream& operator<<(std::ostream& stream, MathProblem const& problem)
+    {
+        bool first = true;
+        for (uint64_t value : problem.m_Variables)
+        {
+            if (first) first = false;
+            else stream << " " << problem.m_Operator << " ";
+            stream << value;
+        }
+
+        return stream << " = " << problem.GetResult();
+    }
+
+private:
+    std::vector<uint64_t> m_Variables;
+    char m_Operator = 0;
+};
+
+std::vector<MathProblem> ReadInput(std::string_view input)
+{
+    // Numbers are written top to bottom, one column each
+    Grid<char> const matrix = ParseCharGrid(input, 0, ' ');
+
+    std::vector<MathProblem> problems;
+    std::vector<std::string> variables;
+    for(size_t column = matrix.GetWidth() - 1;; column--)
+    {
+        GridSlice<char const> cells = matrix.GetColumn(column);
+        std::string vline;
+        for (size_t line = 0; line + 1 < cells.GetSize(); line++) vline += cells[line]; // dodge last line
+        char operand = cells[cells.GetSize() - 1];
+        
+        variables.push_back(vline);
+        if (operand != ' ')
+        {
+            MathProblem& problem = problems.emplace_back();
+            problem.SetOperator(operand);
+            for (std::string const& variable : variables)
+            {
+                problem.AddVariable(ParseInteger<uint64_t>(Trim(variable)));
+            }
+
+            // Clear variables
+            if (column == 0)
+            {
+                break; // End of Parse
+            }
+            else
+            {
+                // Next Problem to Parse
+                variables.clear();
+                column--; // We want to skip the next empty column
+            }
+        }
+    }
+
+    return problems;
+}
+
+class Solution : public Day
+{
+public:
+    void Parse(std::string_view input) override
+    {
+        m_Problems = ReadInput(input);
+    }
+
+    std::optional<std::string> Part1() override
+    {
+        uint64_t total = ParallelReduce(0, m_Problems.size(), 256, uint64_t(0), [this](size_t index)
+        {
+            MathProblem const& problem = m_Problems[index];
+            AOC_LOG_TRACE(problem);
+            return problem.GetResult();
+        }, std::plus<uint64_t>());
+
+        return std::to_string(total);
+    }
+
+private:
+    std::vector<MathProblem> m_Problems;
+};
+
+} // namespace AOC12
+
+AOC_REGISTER_DAY(AOC12, AOC12::Solution);
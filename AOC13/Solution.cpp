@@ -0,0 +1,210 @@
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Common/Day.h"
+#include "Common/Grid.h"
+#include "Common/Log.h"
+
+namespace AOC13
+{
+
+struct Point2D
+{
+    uint64_t x;
+    uint64_t y;
+
+    Point2D(uint64_t x, uint64_t y)
+        : x(x)
+        , y(y)
+    {
+    }
+
+    Point2D(Point2D const& copy) = default;
+    Point2D& operator=(Point2D const& copy) = default;
+
+    bool operator==(Point2D const& other) const
+    {
+        return x == other.y
+            && x == other.y;
+    }
+
+    bool operator!=(Point2D const& other) const
+    {
+        return !(*this == other);
+    }
+};
+
+class Ray
+{
+public:
+    Ray(Point2D origin, Point2D end, bool split)
+        : m_Origin(origin)
+        , m_End(end)
+        , m_Split(split)
+    {
+        assert(m_Origin.x == m_End.x); // Don't support non-vertical stuff
+    }
+
+    Point2D const& GetOrigin() const { return m_Origin; }
+    Point2D const& GetEnd() const { return m_End; }
+
+    bool Contains(Point2D const& point) const
+    {
+        return point.x == m_Origin.x
+            && point.y >= m_Origin.y 
+            && point.y <= m_End.y;
+    }
+
+    bool Intersects(Ray const& ray) const
+    {
+        if (m_Origin.x != ray.m_Origin.x) return false;
+        uint64_t origin = std::max(m_Origin.y, ray.m_Origin.y);
+        uint64_t end = std::min(m_End.y, ray.m_End.y);
+
+        return end >= origin;
+    }
+
+    bool IsSplit() const 
+    {
+        return m_Split;
+    }
+
+    operator bool() const 
+    {
+        return m_Split;
+    }
+
+private:
+    Point2D m_Origin;
+    Point2D m_End;
+    bool m_Split = false;
+};
+
+// The border lets rays step one cell off the sides without bounds checks
+using Matrix = Grid<char>;
+
+Ray RayCast(Matrix const& matrix, Point2D const& origin)
+{
+    for (uint64_t dy = origin.y;  dy < matrix.GetHeight(); dy++)
+    {
+        if (matrix.At(origin.x, dy) == '^')
+        {
+            return Ray(origin, Point2D(origin.x, dy), true);
+        }
+    }
+
+    return Ray(origin, Point2D(origin.x, matrix.GetHeight()), false);
+}
+
+bool AddNoIntersect(std::vector<Ray>& rays, Ray const& ray)
+{
+    for (Ray const& other : rays)
+    {
+        if (other.Intersects(ray))
+        {
+            return false;
+        }
+    }
+
+    rays.push_back(ray);
+    return true;
+}
+
+Matrix ReadInput(std::string_view input)
+{
+    return ParseCharGrid(input, 1, '.');
+}
+
+std::string DebugDraw(Matrix const& matrix, std::vector<Ray> const& rays)
+{
+    std::string drawing;
+    for (uint64_t y = 0; y < matrix.GetHeight(); y++)
+    {
+        for (uint64_t x = 0; x < matrix.GetWidth(); x++)
+        {
+            char c  = matrix.At(x, y);
+            if (c == '.')
+            {
+                Point2D p(x, y);
+                for (Ray const& ray : rays)
+                {
+                    if (ray.Contains(p))
+                    {
+                        c = '|';
+                        break;
+                    }
+                }
+            }
+
+            drawing += c;
+        }
+        drawing += '\n';
+    }
+
+    return drawing;
+}
+
+class Solution : public Day
+{
+public:
+    void Parse(std::string_view input) override
+    {
+        m_Matrix = ReadInput(input);
+    }
+
+    std::optional<std::string> Part1() override
+    {
+        int64_t originX = 0;
+        int64_t originY = 0;
+        if (!m_Matrix.Find('S', originX, originY))
+        {
+            return {};
+        }
+        Point2D origin(originX, originY);
+
+        uint64_t splitCount = 0;
+        std::vector<Ray> rays;
+        rays.push_back(RayCast(m_Matrix, origin));
+
+        for (size_t index = 0; index < rays.size(); index++)
+        {
+            Ray ray = rays.at(index);
+
+            if (ray.IsSplit())
+            {
+                splitCount++;
+
+                //Split Left
+                Point2D leftOrigin = ray.GetEnd();
+                leftOrigin.x -= 1;
+                Ray leftRay = RayCast(m_Matrix, leftOrigin);
+                AddNoIntersect(rays, leftRay);
+
+                //Split Right
+                Point2D rightOrigin = ray.GetEnd();
+                rightOrigin.x += 1;
+                Ray rightRay = RayCast(m_Matrix, rightOrigin);
+                AddNoIntersect(rays, rightRay);
+            }
+        }
+
+        AOC_LOG_DEBUG("Debug\n" << DebugDraw(m_Matrix, rays));
+
+        return std::to_string(splitCount);
+    }
+
+private:
+    Matrix m_Matrix;
+};
+
+} // namespace AOC13
+
+AOC_REGISTER_DAY(AOC13, AOC13::Solution);
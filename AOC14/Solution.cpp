@@ -0,0 +1,279 @@
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <sys/stat.h>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "Common/Day.h"
+#include "Common/Grid.h"
+#include "Common/Profile.h"
+
+namespace AOC14
+{
+
+struct Point2D
+{
+    uint64_t x;
+    uint64_t y;
+
+    Point2D(uint64_t x, uint64_t y)
+        : x(x)
+        , y(y)
+    {
+    }
+
+    Point2D(Point2D const& copy) = default;
+    Point2D& operator=(Point2D const& copy) = default;
+
+    bool operator==(Point2D const& other) const
+    {
+        return x == other.y
+            && x == other.y;
+    }
+
+    bool operator!=(Point2D const& other) const
+    {
+        return !(*this == other);
+    }
+
+    bool operator<(Point2D const& other) const
+    {
+        return std::tie(x, y) < std::tie(other.x, other.y);
+    }
+
+    Point2D operator+(Point2D const& other) const { return Point2D(x + other.x, y + other.y); }
+    Point2D operator-(Point2D const& other) const { return Point2D(x - other.x, y - other.y); }
+
+    static Point2D X;
+    static Point2D Y;
+};
+
+Point2D Point2D::X(1, 0);
+Point2D Point2D::Y(0, 1);
+
+class Ray
+{
+public:
+    Ray(Point2D origin, Point2D end, bool split)
+        : m_Origin(origin)
+        , m_End(end)
+        , m_Split(split)
+    {
+        assert(m_Origin.x == m_End.x); // Don't support non-vertical stuff
+    }
+
+    Point2D const& GetOrigin() const { return m_Origin; }
+    Point2D const& GetEnd() const { return m_End; }
+
+    bool Contains(Point2D const& point) const
+    {
+        return point.x == m_Origin.x
+            && point.y >= m_Origin.y 
+            && point.y <= m_End.y;
+    }
+
+    bool Intersects(Ray const& ray) const
+    {
+        if (m_Origin.x != ray.m_Origin.x) return false;
+        uint64_t origin = std::max(m_Origin.y, ray.m_Origin.y);
+        uint64_t end = std::min(m_End.y, ray.m_End.y);
+
+        return end >= origin;
+    }
+
+    bool IsSplit() const 
+    {
+        return m_Split;
+    }
+
+    operator bool() const 
+    {
+        return m_Split;
+    }
+
+private:
+    Point2D m_Origin;
+    Point2D m_End;
+    bool m_Split = false;
+};
+
+// The border lets rays step one cell off the sides without bounds checks
+using Matrix = Grid<char>;
+
+Ray RayCast(Matrix const& matrix, Point2D const& origin)
+{
+    for (uint64_t dy = origin.y;  dy < matrix.GetHeight(); dy++)
+    {
+        if (matrix.At(origin.x, dy) == '^')
+        {
+            return Ray(origin, Point2D(origin.x, dy), true);
+        }
+    }
+
+    return Ray(origin, Point2D(origin.x, matrix.GetHeight()), false);
+}
+
+class SplitterTree
+{
+    struct Splitter
+    {
+        Point2D Origin;
+        uint64_t Possibilities = 0;
+        Splitter* Left;
+        Splitter* Right;
+
+        Splitter(Point2D const& origin)
+            : Origin(origin)
+        {
+        }
+
+        void ComputePossibilities()
+        {
+            if (Possibilities == 0)
+            {
+                if (Left)
+                {
+                    Left->ComputePossibilities();
+                    Possibilities += Left->Possibilities;
+                }
+                else
+                {
+                    Possibilities += 1;
+                }
+
+                if (Right)
+                {
+                    Right->ComputePossibilities();
+                    Possibilities += Right->Possibilities;
+                }
+                else
+                {
+                    Possibilities += 1;
+                }
+            }
+        }
+    };
+
+public:
+    SplitterTree(Matrix const& matrix, Point2D const& origin)
+        : m_FirstSplitterPosition(std::numeric_limits<uint64_t>::max(),std::numeric_limits<uint64_t>::max())
+    {
+        AOC_PROFILE_SCOPE("AOC14 BuildSplitterTree");
+        std::vector<Point2D> positionQueue;
+
+        if (Ray initialRay = RayCast(matrix, origin))
+        {
+            m_FirstSplitterPosition = initialRay.GetEnd();
+            positionQueue.push_back(initialRay.GetEnd());
+        } 
+
+        for (size_t index = 0; index < positionQueue.size(); index++)
+        {
+            Point2D const& position = positionQueue.at(index);
+            Splitter* current = GetOrCreateSplitter(position);
+
+            if (current->Left == nullptr)
+            {
+                if (auto left = RayCast(matrix, current->Origin - Point2D::X))
+                {
+                    current->Left = GetOrCreateSplitter(left.GetEnd());
+
+                    positionQueue.push_back(left.GetEnd());
+                }
+            }
+
+            if (current->Right == nullptr)
+            {
+                if (auto right = RayCast(matrix,current->Origin + Point2D::X))
+                {
+                    current->Right = GetOrCreateSplitter(right.GetEnd());
+                    positionQueue.push_back(right.GetEnd());
+                }
+            }
+        }
+
+        AOC_PROFILE_GAUGE("AOC14 Splitters", m_Splitters.size());
+    }
+
+    uint64_t GetPossibilityCount() const
+    {
+        AOC_PROFILE_SCOPE("AOC14 ComputePossibilities");
+        auto it = m_Splitters.find(m_FirstSplitterPosition);
+
+        if (it == m_Splitters.end())
+        {
+            return 0;
+        }
+
+        Splitter* firstSplitter = it->second.get();
+
+        firstSplitter->ComputePossibilities();
+        return firstSplitter->Possibilities;
+    }
+
+    Splitter* GetOrCreateSplitter(Point2D const& point)
+    {
+        auto it = m_Splitters.find(point);
+
+        if (it == m_Splitters.end())
+        {
+            auto ptr = std::make_unique<Splitter>(point);
+            ptr->Left = nullptr;
+            ptr->Right = nullptr;
+            auto result = m_Splitters.insert_or_assign(point, std::move(ptr));
+            return result.first->second.get();
+        }
+
+        return it->second.get();
+    }
+
+private:
+    Point2D m_FirstSplitterPosition;
+    std::map<Point2D, std::unique_ptr<Splitter>> m_Splitters;
+};
+
+Matrix ReadInput(std::string_view input)
+{
+    return ParseCharGrid(input, 1, '.');
+}
+
+class Solution : public Day
+{
+public:
+    void Parse(std::string_view input) override
+    {
+        m_Matrix = ReadInput(input);
+    }
+
+    std::optional<std::string> Part1() override
+    {
+        int64_t originX = 0;
+        int64_t originY = 0;
+        if (!m_Matrix.Find('S', originX, originY))
+        {
+            return {};
+        }
+        Point2D origin(originX, originY);
+
+        SplitterTree tree(m_Matrix, origin);
+        return std::to_string(tree.GetPossibilityCount());
+    }
+
+private:
+    Matrix m_Matrix;
+};
+
+} // namespace AOC14
+
+AOC_REGISTER_DAY(AOC14, AOC14::Solution);
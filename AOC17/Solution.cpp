@@ -0,0 +1,212 @@
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <set>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+#include "Common/Day.h"
+#include "Common/InputFile.h"
+#include "Common/Profile.h"
+#include "Common/Scanner.h"
+
+namespace AOC17
+{
+
+struct Position3D
+{
+    int64_t x, y, z;
+
+    uint64_t GetLengthSquared() const
+    {
+        return x * x + y * y + z * z;
+    }
+};
+
+// "x,y,z"
+Position3D ReadPosition(std::string_view line)
+{
+    Position3D position = {};
+    Scanner scanner(line);
+    [[maybe_unused]] bool valid = scanner.Read(position.x) && scanner.Skip(',')
+        && scanner.Read(position.y) && scanner.Skip(',')
+        && scanner.Read(position.z);
+    assert(valid);
+
+    return position;
+}
+
+std::ostream& operator<<(std::ostream& stream, Position3D const& position)
+{
+    return stream << "Position(" << position.x << ", " << position.y << ", " << position.z << ")";
+}
+
+bool operator==(Position3D const& l, Position3D const& r) { return std::tie(l.x, l.y, l.z) == std::tie(r.x, r.y, r.z); };
+bool operator!=(Position3D const& l, Position3D const& r) { return std::tie(l.x, l.y, l.z) != std::tie(r.x, r.y, r.z); };
+bool operator<(Position3D const& l, Position3D const& r) { return std::tie(l.x, l.y, l.z) < std::tie(r.x, r.y, r.z); };
+bool operator>(Position3D const& l, Position3D const& r) { return std::tie(l.x, l.y, l.z) > std::tie(r.x, r.y, r.z); };
+
+Position3D operator+(Position3D const& l, Position3D const& r) { return {l.x + r.x, l.y + r.y, l.z + r.z }; }
+Position3D operator-(Position3D const& l, Position3D const& r) { return {l.x - r.x, l.y - r.y, l.z - r.z }; }
+
+struct PositionPairData
+{
+    size_t First;
+    size_t Second;
+    uint64_t DistanceSquared;
+};
+
+std::vector<Position3D> ReadInput(std::string_view input)
+{
+    std::vector<Position3D> result;
+
+    Tokenizer lines(input);
+    std::string_view line;
+    while (lines.Next(line))
+    {
+        result.push_back(ReadPosition(line));
+    }
+
+    return result;
+}
+
+std::vector<PositionPairData> ComputeAllPairs(std::vector<Position3D> const& positions)
+{
+    AOC_PROFILE_SCOPE("AOC17 ComputeAllPairs");
+    std::vector<PositionPairData> result;
+
+    for (size_t first = 0; first < positions.size(); first++)
+    {
+        for (size_t second = first + 1; second < positions.size(); second++)
+        {
+            Position3D firstPosition = positions.at(first);
+            Position3D secondPosition = positions.at(second);
+
+            PositionPairData& ppd = result.emplace_back(); 
+            ppd.First = first;
+            ppd.Second = second;
+            ppd.DistanceSquared = (firstPosition - secondPosition).GetLengthSquared();
+        }
+    }
+
+    AOC_PROFILE_COUNTER("AOC17 Pairs", result.size());
+    AOC_PROFILE_SCOPE("AOC17 SortPairs");
+    std::sort(result.begin(), result.end(), [](PositionPairData const& l, PositionPairData const& r)
+    {
+        return l.DistanceSquared < r.DistanceSquared;
+    });
+
+    return result;
+}
+
+void ProcessPairIntoChains(std::vector<std::set<size_t>>& chains, size_t first, size_t second)
+{
+    auto const& fIt = std::find_if(chains.begin(), chains.end(), [first] (std::set<size_t> const& set)
+    {
+        return set.find(first) != set.end();
+    });
+
+    auto const& sIt = std::find_if(chains.begin(), chains.end(), [second] (std::set<size_t> const& set)
+    {
+        return set.find(second) != set.end();
+    });
+    
+    if (fIt != chains.end() && sIt != chains.end())
+    {
+        if (fIt != sIt) // Only if Distinct (otherwise nothing to do)
+        {
+            // Merge into fIt
+            std::for_each(sIt->begin(), sIt->end(), [&fIt] (size_t element) 
+            {
+                fIt->insert(element);
+            });
+            chains.erase(sIt);
+        }
+    }
+    else if (fIt != chains.end() && sIt == chains.end())
+    {
+        fIt->insert(second);
+    }
+    else if (fIt == chains.end() && sIt != chains.end())
+    {
+        sIt->insert(first);
+    }
+    else if (fIt == chains.end() && sIt == chains.end())
+    {
+        auto& chain = chains.emplace_back();
+        chain.insert(first);
+        chain.insert(second);
+    }
+}
+
+std::vector<std::set<size_t>> ConnectClosestNPairs(std::vector<PositionPairData> const& pairs, size_t count)
+{
+    AOC_PROFILE_SCOPE("AOC17 ConnectClosestNPairs");
+    std::vector<std::set<size_t>> result;
+
+    for (size_t index = 0; index < count; index++)
+    {
+        auto const& pair = pairs.at(index);
+        ProcessPairIntoChains(result, pair.First, pair.Second);
+    }
+
+    std::sort(result.begin(), result.end(), [](std::set<size_t> const& l, std::set<size_t> const& r)
+    {
+        return l.size() > r.size();
+    });
+
+    return result;
+}
+
+PositionPairData GetThePair(std::vector<Position3D> const& positions, std::vector<PositionPairData> const& pairs)
+{
+    AOC_PROFILE_SCOPE("AOC17 GetThePair");
+    std::vector<std::set<size_t>> chains;
+    for (auto const& pair : pairs)
+    {
+        ProcessPairIntoChains(chains, pair.First, pair.Second);
+
+        if (chains.size() == 1 && chains.at(0).size() == positions.size())
+        {
+            return pair;
+        }
+    }
+
+    return {};
+}
+
+class Solution : public Day
+{
+public:
+    void Parse(std::string_view input) override
+    {
+        m_Positions = ReadInput(input);
+    }
+
+    std::optional<std::string> Part1() override
+    {
+        auto pairs = ComputeAllPairs(m_Positions);
+        auto pair = GetThePair(m_Positions, pairs);
+
+        auto const& first = m_Positions.at(pair.First);
+        auto const& second = m_Positions.at(pair.Second);
+
+        int64_t total = first.x * second.x;
+        return std::to_string(total);
+    }
+
+private:
+    std::vector<Position3D> m_Positions;
+};
+
+} // namespace AOC17
+
+AOC_REGISTER_DAY(AOC17, AOC17::Solution);
@@ -0,0 +1,108 @@
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Common/Day.h"
+#include "Common/InputFile.h"
+#include "Common/Scanner.h"
+
+namespace AOC18
+{
+
+struct Point2D
+{
+    uint64_t x, y;
+};
+
+struct Rectangle
+{
+    uint64_t x, y, width, height;
+
+    uint64_t GetArea() const
+    {
+        return width * height;
+    }
+
+    static Rectangle CreateFromPoints(Point2D const& a, Point2D const& b)
+    {
+        uint64_t minX = std::min(a.x, b.x);
+        uint64_t maxX = std::max(a.x, b.x);
+        uint64_t minY = std::min(a.y, b.y);
+        uint64_t maxY = std::max(a.y, b.y);
+        uint64_t width = maxX - minX + 1; // a rectangle {0, 0}, {0, 1} should have a width of 1
+        uint64_t height = maxY - minY + 1; // a rectangle {0, 0}, {1, 0} should have a height of 1
+        return { minX, minY, width, height };
+    }
+};
+
+std::vector<Point2D> ReadInput(std::string_view input)
+{
+    std::vector<Point2D> result;
+
+    Tokenizer lines(input);
+    std::string_view line;
+    while (lines.Next(line)) 
+    { 
+        Scanner scanner(line);
+        Point2D& p = result.emplace_back();
+        [[maybe_unused]] bool valid = scanner.Read(p.x) && scanner.Skip(',') && scanner.Read(p.y);
+        assert(valid);
+    }
+
+    return result;
+}
+
+Rectangle GetBiggestRectangleInPoints(std::vector<Point2D> const& points)
+{
+    Rectangle bestRectangle;
+    uint64_t bestArea = std::numeric_limits<uint64_t>::min();
+
+    for (size_t first = 0; first < points.size(); first++)
+    {
+        for (size_t second = first + 1; second < points.size(); second++)
+        {
+            Point2D const& l = points.at(first);
+            Point2D const& r = points.at(second);
+            Rectangle currentRectangle = Rectangle::CreateFromPoints(l, r);
+            uint64_t currentArea = currentRectangle.GetArea();
+            if (currentArea > bestArea)
+            {
+                bestRectangle = currentRectangle;
+                bestArea = currentArea;
+            }
+        }
+    }
+
+    return bestRectangle;
+}
+
+class Solution : public Day
+{
+public:
+    void Parse(std::string_view input) override
+    {
+        m_Points = ReadInput(input);
+    }
+
+    std::optional<std::string> Part1() override
+    {
+        Rectangle biggestRectangle = GetBiggestRectangleInPoints(m_Points);
+        return std::to_string(biggestRectangle.GetArea());
+    }
+
+private:
+    std::vector<Point2D> m_Points;
+};
+
+} // namespace AOC18
+
+AOC_REGISTER_DAY(AOC18, AOC18::Solution);
@@ -0,0 +1,138 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+#include "Common/DialSummary.h"
+#include "Common/Scanner.h"
+
+namespace AOC2
+{
+
+// Modulus positions dial starting on Start, counting every click that lands on 0 whichever way it turns.
+// 'L' turns towards the higher positions (Modulus - 1 wraps to 0), 'R' towards the lower ones (0 wraps to Modulus - 1).
+// Both are known at compile time, so the modulos are multiplies and shifts rather than divisions.
+template<uint64_t Modulus = 100, uint64_t Start = 50>
+class DialThatZCounts
+{
+public:
+    static_assert(Modulus > 0 && Start < Modulus, "The dial starts on one of its positions");
+
+    static constexpr uint64_t K_START = Start;
+
+    // "L45" -> 'L', 45
+    static void ParseRotation(std::string_view input, char& direction, uint64_t& count)
+    {
+        Scanner scanner(input);
+        scanner.ReadChar(direction);
+        scanner.Read(count);
+    }
+
+    // Same rotation, for every start position at once
+    static void Summarize(DialSummaryBuilder& builder, std::string_view input)
+    {
+        static_assert(Modulus == DialSummary::K_POSITIONS, "Summaries are for the puzzle's dial");
+
+        char direction = '\0';
+        uint64_t count = 0;
+        ParseRotation(input, direction, count);
+
+        // Like Rotate, anything but 'L' turns as 'R'
+        if (direction == 'L') builder.TurnUp(count);
+        else builder.TurnDown(count);
+    }
+
+    void Rotate(std::string_view input)
+    {
+        char direction = '\0';
+        uint64_t count = 0;
+        ParseRotation(input, direction, count);
+
+        Rotate(direction, count);
+    }
+
+    // The password of a whole log, at compile time when the log is a constant
+    static constexpr uint64_t Solve(std::string_view log)
+    {
+        DialThatZCounts dial;
+        char direction = '\0';
+        uint64_t count = 0;
+        while (NextRotation(log, direction, count))
+        {
+            dial.Rotate(direction, count);
+        }
+        return dial.GetZCount();
+    }
+
+    // Constant time whatever the count : the first click landing on 0, then one more every full turn
+    constexpr void Rotate(char direction, uint64_t count)
+    {
+        uint64_t firstZero = 0;
+        if (direction == 'L')
+        {
+            firstZero = Modulus - m_Index;
+            m_Index = (m_Index + count % Modulus) % Modulus;
+        }
+        else // direction == 'R'
+        {
+            firstZero = m_Index == 0 ? Modulus : m_Index;
+            m_Index = (m_Index + Modulus - count % Modulus) % Modulus;
+        }
+
+        if (count >= firstZero) m_ZCount += 1 + (count - firstZero) / Modulus;
+    }
+
+    // One click at a time, the reference Rotate is checked against
+    constexpr void RotateByClicks(char direction, uint64_t count)
+    {
+        if (direction == 'L')
+        {
+            while (count--)
+            {
+                RotateLeft();
+            }
+        }
+        else // direction == 'R'
+        {
+            while (count--)
+            {
+                RotateRight();
+            }
+        }
+    }
+
+    constexpr void RotateLeft()
+    {
+        if (m_Index == Modulus - 1)
+        {
+            m_Index = 0;
+            m_ZCount++;
+        }
+        else
+        {
+            m_Index++;
+        }
+    }
+
+    constexpr void RotateRight()
+    {
+        if (m_Index == 0)
+        {
+            m_Index = Modulus - 1;
+        }
+        else
+        {
+            m_Index--;
+            if (m_Index == 0) m_ZCount++;
+        }
+    }
+
+    constexpr uint64_t GetIndex() const { return m_Index; }
+    constexpr uint64_t GetZCount() const { return m_ZCount; }
+
+private:
+    uint64_t m_Index = Start;
+    uint64_t m_ZCount = 0;
+};
+
+} // namespace AOC2
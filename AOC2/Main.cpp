@@ -1,83 +1,20 @@
+#include "Dial.h"
 
-#include <cassert>
-#include <cstdint>
-#include <cstdlib>
-#include <fstream>
 #include <iostream>
-#include <sstream>
-#include <string>
+#include <string_view>
 
-class DialThatZCounts
-{
-public:
-    void Rotate(std::string const& input)
-    {
-        char direction;
-        uint64_t count;
-        std::istringstream stream(input);
-        stream >> direction;
-        stream >> count;
-        
-        if (direction == 'L')
-        {
-            while (count--) 
-            {
-                RotateLeft();
-            }
-        }
-        else // direction == 'R'
-        {
-            while (count--) 
-            {
-                RotateRight();
-            }
-        }
-    }
-
-    void RotateLeft()
-    {
-        if (m_Index == 99)
-        {
-            m_Index = 0;
-            m_ZCount++;
-        }
-        else
-        {
-            m_Index++;
-        }
-    }
-
-    void RotateRight()
-    {
-        if (m_Index == 0)
-        {
-            m_Index = 99;
-        }
-        else
-        {
-            m_Index--;
-            if (m_Index == 0) m_ZCount++;
-        }
-    }
-
-    uint64_t GetZCount() const { return m_ZCount; }
-
-private:
-    uint64_t m_Index = 50;
-    uint64_t m_ZCount = 0;
-};
+#include "Common/Day.h"
+#include "Common/DialSummary.h"
 
 int main(int argc, char** argv)
 {
     std::cout << "Begining Pasword cracking\n\n";
-    DialThatZCounts dial;
-    std::ifstream stream("input.txt");
-    std::string line;
-    while (std::getline(stream, line))
+
+    // --all-starts [<file>] : the password for each of the dial's start positions instead of 50
+    if (argc > 1 && std::string_view(argv[1]) == "--all-starts")
     {
-        dial.Rotate(line);
+        return RunAllStarts(argc > 2 ? argv[2] : "input.txt", &AOC2::DialThatZCounts<>::Summarize);
     }
 
-    std::cout << "Password : " << dial.GetZCount() << "\n";
-    return 0;
-}
\ No newline at end of file
+    return RunDay("AOC2", argc, argv, "--all-starts [file]");
+}
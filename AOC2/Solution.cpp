@@ -0,0 +1,65 @@
+#include "Dial.h"
+
+#include <cassert>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Common/Day.h"
+#include "Common/DialSummary.h"
+#include "Common/InputFile.h"
+#include "Common/Scanner.h"
+
+namespace AOC2
+{
+
+// The puzzle's example, solved while compiling
+static_assert(DialThatZCounts<>::Solve("L68\nL30\nR48\nL5\nR60\nL55\nL1\nL99\nR14\nL82\n") == 6);
+
+class Solution : public Day
+{
+public:
+    void Parse(std::string_view input) override
+    {
+        Tokenizer lines(input);
+        std::string_view line;
+        while (lines.Next(line))
+        {
+            m_Rotations.push_back(line);
+        }
+    }
+
+    bool Reset() override
+    {
+        m_Rotations.clear();
+        return true;
+    }
+
+    std::optional<std::string> Part1() override
+    {
+        if (m_Rotations.size() > K_DIAL_ROTATIONS_PER_CHUNK)
+        {
+            return std::to_string(SummarizeRotations(m_Rotations, &DialThatZCounts<>::Summarize).GetCrossings(DialThatZCounts<>::K_START));
+        }
+
+        DialThatZCounts<> dial;
+        for (std::string_view rotation : m_Rotations)
+        {
+            dial.Rotate(rotation);
+        }
+
+        return std::to_string(dial.GetZCount());
+    }
+
+private:
+    std::vector<std::string_view> m_Rotations;
+};
+
+} // namespace AOC2
+
+AOC_REGISTER_DAY(AOC2, AOC2::Solution);
@@ -0,0 +1,250 @@
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <set>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "Common/Day.h"
+#include "Common/InputFile.h"
+#include "Common/Log.h"
+#include "Common/Pipeline.h"
+#include "Common/Scanner.h"
+
+namespace AOC20
+{
+
+namespace Flags
+{
+    template<typename Integer>
+    Integer Set(Integer data, size_t index)
+    {
+        static_assert(std::is_integral_v<Integer>, "Must be Integral");
+        assert(index < sizeof(Integer) * 8);
+        Integer mask = 0x1 << index;
+
+        return data | mask;
+    }
+
+    template<typename Integer>
+    Integer Clear(Integer data, size_t index)
+    {
+        static_assert(std::is_integral_v<Integer>, "Must be Integral");
+        assert(index < sizeof(Integer) * 8);
+        Integer mask = 0x1 << index;
+
+        return data & !mask;
+    }
+
+    template<typename Integer>
+    Integer Toggle(Integer data, size_t index)
+    {
+        static_assert(std::is_integral_v<Integer>, "Must be Integral");
+        assert(index < sizeof(Integer) * 8);
+        Integer mask = 0x1 << index;
+
+        return data ^ mask;
+    }
+
+    template<typename Integer>
+    bool Get(Integer data, size_t index)
+    {
+        static_assert(std::is_integral_v<Integer>, "Must be Integral");
+        assert(index < sizeof(Integer) * 8);
+        Integer mask = 0x1 << index;
+        
+        return data & mask;
+    }
+}
+
+struct Machine
+{
+    uint64_t LightState;
+    size_t LightCount;
+
+    std::vector<uint64_t> Buttons;
+
+    std::vector<uint64_t> Joltages;
+
+    void Parse(std::string_view line)
+    {
+        Buttons.clear();
+        Joltages.clear();
+
+        Scanner scanner(line);
+        char c;
+        while (scanner.ReadChar(c))
+        {
+            switch (c)
+            {
+                case '[': ParseLights(scanner.ReadUntil(']')); break;
+                case '(': ParseButton(scanner.ReadUntil(')')); break;
+                case '{': ParseJoltage(scanner.ReadUntil('}')); break;
+
+                default: break;
+            }
+        }
+    }
+
+    void ParseLights(std::string_view data)
+    {
+        LightCount = data.size();
+        LightState = 0;
+        for (size_t index = 0; index < data.size(); index++)
+        {
+            if (data.at(index) == '#')
+            {
+                LightState = Flags::Set(LightState, index);
+            }
+        }
+    }
+
+    // "1,3,5"
+    void ParseButton(std::string_view data)
+    {
+        uint64_t bindings = 0;
+
+        Scanner scanner(data);
+        size_t index;
+        while (scanner.ReadNext(index))
+        {
+            bindings = Flags::Set(bindings, index);
+        }
+
+        Buttons.push_back(bindings);
+    }
+
+    // "3,5,4,7"
+    void ParseJoltage(std::string_view data)
+    {
+        Joltages.reserve(data.size());
+
+        Scanner scanner(data);
+        uint64_t joltage;
+        while (scanner.ReadNext(joltage))
+        {
+            Joltages.push_back(joltage);
+        }
+    }
+};
+
+std::ostream& PrintLightState(std::ostream& stream, uint64_t state, size_t count)
+{
+    stream << '[';
+    for (size_t index = 0; index < count; index++)
+    {
+        stream << (Flags::Get(state,count - index - 1) ? '#' : '.');
+    }
+    stream << "] ";
+    return stream;
+}
+
+std::ostream& operator<<(std::ostream& stream, Machine const& machine)
+{
+    PrintLightState(stream, machine.LightState, machine.LightCount);
+    for (auto const& bindings : machine.Buttons)
+    {
+        stream << '(';
+        bool first = true;
+        for (size_t index = 0; index < machine.LightCount; index++)
+        {
+            if (!Flags::Get(bindings, index)) continue;
+
+            if (first) first = false;
+            else stream << ',';
+            stream << index;
+        }
+        stream << ") ";
+    }
+
+    stream << '{';
+    {
+        bool first = true;
+        for (uint64_t joltage : machine.Joltages)
+        {
+            if (first) first = false;
+            else stream << ',';
+            stream << joltage;
+        }
+    }
+    stream << '}';
+    stream << '\n';
+
+    return stream;
+}
+
+size_t Solve(Machine const& machine)
+{
+    std::unordered_set<uint64_t> states;
+    states.insert(0); // initial state
+
+    size_t iterations = 0;
+    while (states.find(machine.LightState) == states.end())
+    {
+        std::unordered_set<uint64_t> nexts;
+        for (uint64_t state : states)
+        {
+            for (uint64_t bindings : machine.Buttons)
+            {
+                uint64_t next = state ^ bindings;
+                nexts.insert(next);
+            }
+        }
+
+        for (uint64_t next :nexts) states.insert(next);
+        iterations++;
+    }
+
+    return iterations;
+}
+
+class Solution : public Day
+{
+public:
+    void Parse(std::string_view input) override
+    {
+        // Machines are parsed while the previous ones are solved, by Part1
+        m_Input = input;
+    }
+
+    bool Reset() override
+    {
+        m_Input = {};
+        return true;
+    }
+
+    std::optional<std::string> Part1() override
+    {
+        std::vector<SolverSlot<uint64_t>> totals(GetPipelineSolverCount());
+        StreamLines<Machine>(m_Input,
+            [](std::string_view line, Machine& machine) { machine.Parse(line); return true; },
+            [&totals](size_t solver, Machine const& machine)
+            {
+                size_t iterations = Solve(machine);
+                AOC_LOG_TRACE("Solving Machine : " << machine << " : " << iterations);
+
+                totals[solver].Value += iterations;
+            },
+            totals.size());
+
+        uint64_t total = 0;
+        for (auto const& slot : totals) total += slot.Value;
+
+        return std::to_string(total);
+    }
+
+private:
+    std::string_view m_Input;
+};
+
+} // namespace AOC20
+
+AOC_REGISTER_DAY(AOC20, AOC20::Solution);
@@ -1,8 +1,7 @@
 
-#include <cassert>
+#include "Common/Day.h"
 
 int main(int argc, char** argv)
 {
-
-    return 0;
-}
\ No newline at end of file
+    return RunDay("AOC21", argc, argv);
+}
@@ -0,0 +1,20 @@
+
+#include <string_view>
+
+#include "Common/Day.h"
+
+namespace AOC21
+{
+
+// Not solved yet, registered so every tool already lists the day
+class Solution : public Day
+{
+public:
+    void Parse(std::string_view /*input*/) override
+    {
+    }
+};
+
+} // namespace AOC21
+
+AOC_REGISTER_DAY_FLAGS(AOC21, AOC21::Solution, DayFlag_Placeholder);
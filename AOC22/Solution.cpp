@@ -0,0 +1,286 @@
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <set>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "Common/Day.h"
+#include "Common/InputFile.h"
+#include "Common/Log.h"
+#include "Common/ParseCache.h"
+#include "Common/Scanner.h"
+
+namespace AOC22
+{
+
+class Device
+{
+public:
+    Device(std::string const& name)
+        : m_Name(name)
+    {
+    }
+
+    std::string const& GetName() const { return m_Name; }
+    std::vector<Device const*> const& GetInputs() const { return m_Inputs; }
+    std::vector<Device const*> const& GetOutputs() const { return m_Outputs; }
+
+    void AddInput(Device const* device)
+    {
+        m_Inputs.push_back(device);
+    }
+
+    void AddOutput(Device const* device)
+    {
+        m_Outputs.push_back(device);
+    }
+
+    bool HasInput(Device const* device) const
+    {
+        for (Device const* input : m_Inputs)
+        {
+            if (device == input) return true;
+        }
+        return false;
+    }
+    
+    bool HasOutput(Device const* device) const
+    {
+        for (Device const* output : m_Outputs)
+        {
+            if (device == output) return true;
+        }
+        return false;
+    }
+
+    void GetInputs(std::vector<Device const*> inputs) const
+    {
+        for (Device const* device : m_Inputs)
+        {
+            inputs.push_back(device);
+        }
+    }
+
+    void GetOutputs(std::vector<Device const*>& outputs) const
+    {
+        for (Device const* device : m_Outputs)
+        {
+            outputs.push_back(device);
+        }
+    }
+
+private:
+    std::string m_Name;
+    std::vector<Device const*> m_Inputs;
+    std::vector<Device const*> m_Outputs;
+};
+
+class DeviceDatabase
+{
+public:
+    Device* Find(std::string_view name)
+    {
+        auto it = std::find_if(m_Devices.begin(), m_Devices.end(), [&name](auto const& device) { return device->GetName() == name; });
+        return it != m_Devices.end() ? it->get() : nullptr;
+    }
+
+    Device* New(std::string const& name)
+    {
+        return m_Devices.emplace_back(std::make_unique<Device>(name)).get();
+    }
+    
+    Device* GetOrCreate(std::string_view name)
+    {
+        if (auto* device = Find(name))
+        {
+            return device;
+        }
+
+        return New(std::string(name));
+    }
+
+    std::vector<std::unique_ptr<Device>> const& GetDevices() const { return m_Devices; }
+
+    // Snapshot : every name, then every device's outputs and inputs as indices of the devices
+    void Save(CacheWriter& writer) const
+    {
+        std::unordered_map<Device const*, uint32_t> indices;
+        for (size_t index = 0; index < m_Devices.size(); index++)
+        {
+            indices.emplace(m_Devices[index].get(), static_cast<uint32_t>(index));
+        }
+
+        writer.Write<uint64_t>(m_Devices.size());
+        for (auto const& device : m_Devices)
+        {
+            writer.WriteString(device->GetName());
+        }
+
+        std::vector<uint32_t> links;
+        auto writeLinks = [&](std::vector<Device const*> const& devices)
+        {
+            links.clear();
+            for (Device const* device : devices) links.push_back(indices.at(device));
+            writer.WriteArray(links);
+        };
+        for (auto const& device : m_Devices)
+        {
+            writeLinks(device->GetOutputs());
+            writeLinks(device->GetInputs());
+        }
+    }
+
+    bool Load(CacheReader& reader)
+    {
+        uint64_t count;
+        if (!reader.Read(count)) return false;
+
+        m_Devices.clear();
+        for (uint64_t index = 0; index < count; index++)
+        {
+            std::string_view name;
+            if (!reader.ReadString(name)) return false;
+            New(std::string(name));
+        }
+
+        std::vector<uint32_t> links;
+        for (auto const& device : m_Devices)
+        {
+            if (!reader.ReadArray(links)) return false;
+            for (uint32_t link : links)
+            {
+                if (link >= m_Devices.size()) return false;
+                device->AddOutput(m_Devices[link].get());
+            }
+
+            if (!reader.ReadArray(links)) return false;
+            for (uint32_t link : links)
+            {
+                if (link >= m_Devices.size()) return false;
+                device->AddInput(m_Devices[link].get());
+            }
+        }
+
+        return true;
+    }
+private:
+    std::vector<std::unique_ptr<Device>> m_Devices;
+};
+
+DeviceDatabase ReadInput(std::string_view input)
+{
+    DeviceDatabase db;
+    
+    Tokenizer lines(input);
+    std::string_view line;
+    while (lines.Next(line))
+    {
+        Scanner scanner(line);
+        Device* device = db.GetOrCreate(scanner.ReadUntil(':'));
+
+        [[maybe_unused]] bool separated = scanner.Skip(' '); // skip first <whitespace>
+        assert(separated);
+
+        Tokenizer outputs(scanner.GetRemaining(), ' ');
+        std::string_view deviceName;
+        while (outputs.Next(deviceName))
+        {
+            Device* connectedDevice = db.GetOrCreate(deviceName);
+            device->AddOutput(connectedDevice);
+            connectedDevice->AddInput(device);
+        }
+    }
+
+    return db;
+}
+
+bool Contains(std::vector<Device const*> const& path, Device const* device)
+{
+    return std::find(path.begin(), path.end(), device) != path.end();
+}
+
+std::vector<std::vector<Device const*>> GetAllPaths(Device const* begin, Device const* end)
+{
+    std::vector<std::vector<Device const*>> paths;
+    paths.push_back({ begin });
+
+    while (true)
+    {
+        // Find any explorable path
+        auto it = std::find_if(paths.begin(), paths.end(), [end] (auto const& path) { return path.back() != end; });
+        if (it == paths.end()) break; // All Paths found
+
+        std::vector<Device const*> nexts;
+        it->back()->GetOutputs(nexts);
+        // Remove cycles
+        auto _ = std::remove_if(nexts.begin(), nexts.end(), [it] (Device const* next) { return Contains(*it, next); });
+
+        if (nexts.empty())
+        {
+            // No remaining nexts => this path is a dead-end
+            paths.erase(it);
+        }
+        else
+        {
+            std::vector<Device const*> copy = *it;
+            //small optimization => reuse the current path for the first iteration
+            it->push_back(nexts.at(0));
+            // Duplicate path for each Next
+            std::for_each(nexts.begin() + 1, nexts.end(), [&copy, &paths] (Device const* next)
+            {
+                auto& nextPath = paths.emplace_back(copy);
+                nextPath.push_back(next);
+            });
+        }
+    }
+
+    return paths;
+}
+
+class Solution : public Day
+{
+public:
+    void Parse(std::string_view input) override
+    {
+        m_Database = ReadInput(input);
+    }
+
+    // Snapshot : the device graph, rebuilt without looking any name up
+    uint32_t GetCacheLayout() const override { return 1; }
+
+    void SaveParsed(CacheWriter& writer) const override
+    {
+        m_Database.Save(writer);
+    }
+
+    bool LoadParsed(CacheReader& reader) override
+    {
+        return m_Database.Load(reader);
+    }
+
+    std::optional<std::string> Part1() override
+    {
+        Device const* you = m_Database.Find("svr");
+        Device const* out = m_Database.Find("out");
+
+        AOC_LOG_DEBUG("Finding all pathes");
+
+        auto paths = GetAllPaths(you, out);
+
+        return std::to_string(paths.size());
+    }
+
+private:
+    DeviceDatabase m_Database;
+};
+
+} // namespace AOC22
+
+AOC_REGISTER_DAY_FLAGS(AOC22, AOC22::Solution, DayFlag_Slow);
@@ -0,0 +1,277 @@
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "Common/Day.h"
+#include "Common/InputFile.h"
+#include "Common/Log.h"
+#include "Common/ParseCache.h"
+#include "Common/Scanner.h"
+
+namespace AOC23
+{
+
+class Device
+{
+public:
+    Device(std::string const& name)
+        : m_Name(name)
+    {
+    }
+
+    std::string const& GetName() const { return m_Name; }
+    std::vector<Device const*> const& GetInputs() const { return m_Inputs; }
+    std::vector<Device const*> const& GetOutputs() const { return m_Outputs; }
+
+    void AddInput(Device const* device)
+    {
+        m_Inputs.push_back(device);
+    }
+
+    void AddOutput(Device const* device)
+    {
+        m_Outputs.push_back(device);
+    }
+
+    bool HasInput(Device const* device) const
+    {
+        for (Device const* input : m_Inputs)
+        {
+            if (device == input) return true;
+        }
+        return false;
+    }
+    
+    bool HasOutput(Device const* device) const
+    {
+        for (Device const* output : m_Outputs)
+        {
+            if (device == output) return true;
+        }
+        return false;
+    }
+
+    void GetInputs(std::vector<Device const*> inputs) const
+    {
+        for (Device const* device : m_Inputs)
+        {
+            inputs.push_back(device);
+        }
+    }
+
+    void GetOutputs(std::vector<Device const*>& outputs) const
+    {
+        for (Device const* device : m_Outputs)
+        {
+            outputs.push_back(device);
+        }
+    }
+
+private:
+    std::string m_Name;
+    std::vector<Device const*> m_Inputs;
+    std::vector<Device const*> m_Outputs;
+};
+
+class DeviceDatabase
+{
+public:
+    Device* Find(std::string_view name)
+    {
+        auto it = std::find_if(m_Devices.begin(), m_Devices.end(), [&name](auto const& device) { return device->GetName() == name; });
+        return it != m_Devices.end() ? it->get() : nullptr;
+    }
+
+    Device* New(std::string const& name)
+    {
+        return m_Devices.emplace_back(std::make_unique<Device>(name)).get();
+    }
+    
+    Device* GetOrCreate(std::string_view name)
+    {
+        if (auto* device = Find(name))
+        {
+            return device;
+        }
+
+        return New(std::string(name));
+    }
+
+    std::vector<std::unique_ptr<Device>> const& GetDevices() const { return m_Devices; }
+
+    // Snapshot : every name, then every device's outputs and inputs as indices of the devices
+    void Save(CacheWriter& writer) const
+    {
+        std::unordered_map<Device const*, uint32_t> indices;
+        for (size_t index = 0; index < m_Devices.size(); index++)
+        {
+            indices.emplace(m_Devices[index].get(), static_cast<uint32_t>(index));
+        }
+
+        writer.Write<uint64_t>(m_Devices.size());
+        for (auto const& device : m_Devices)
+        {
+            writer.WriteString(device->GetName());
+        }
+
+        std::vector<uint32_t> links;
+        auto writeLinks = [&](std::vector<Device const*> const& devices)
+        {
+            links.clear();
+            for (Device const* device : devices) links.push_back(indices.at(device));
+            writer.WriteArray(links);
+        };
+        for (auto const& device : m_Devices)
+        {
+            writeLinks(device->GetOutputs());
+            writeLinks(device->GetInputs());
+        }
+    }
+
+    bool Load(CacheReader& reader)
+    {
+        uint64_t count;
+        if (!reader.Read(count)) return false;
+
+        m_Devices.clear();
+        for (uint64_t index = 0; index < count; index++)
+        {
+            std::string_view name;
+            if (!reader.ReadString(name)) return false;
+            New(std::string(name));
+        }
+
+        std::vector<uint32_t> links;
+        for (auto const& device : m_Devices)
+        {
+            if (!reader.ReadArray(links)) return false;
+            for (uint32_t link : links)
+            {
+                if (link >= m_Devices.size()) return false;
+                device->AddOutput(m_Devices[link].get());
+            }
+
+            if (!reader.ReadArray(links)) return false;
+            for (uint32_t link : links)
+            {
+                if (link >= m_Devices.size()) return false;
+                device->AddInput(m_Devices[link].get());
+            }
+        }
+
+        return true;
+    }
+private:
+    std::vector<std::unique_ptr<Device>> m_Devices;
+};
+
+DeviceDatabase ReadInput(std::string_view input)
+{
+    DeviceDatabase db;
+    
+    Tokenizer lines(input);
+    std::string_view line;
+    while (lines.Next(line))
+    {
+        Scanner scanner(line);
+        Device* device = db.GetOrCreate(scanner.ReadUntil(':'));
+
+        [[maybe_unused]] bool separated = scanner.Skip(' '); // skip first <whitespace>
+        assert(separated);
+
+        Tokenizer outputs(scanner.GetRemaining(), ' ');
+        std::string_view deviceName;
+        while (outputs.Next(deviceName))
+        {
+            Device* connectedDevice = db.GetOrCreate(deviceName);
+            device->AddOutput(connectedDevice);
+            connectedDevice->AddInput(device);
+        }
+    }
+
+    return db;
+}
+
+size_t CountAllPathsRecursive(Device const* begin, Device const* end, std::map<Device const*, size_t>& cache)
+{
+    size_t count = 0;
+
+    for (auto output : begin->GetOutputs())
+    {
+        if (cache.find(output) != cache.end())
+            count += cache.at(output);
+        else if (output == end)
+            count++;
+        else
+            count += CountAllPathsRecursive(output, end, cache);        
+    }
+
+    cache.emplace(begin, count);
+    return count;
+}
+
+size_t CountAllPathsRecursive(Device const* begin, Device const* end)
+{
+    std::map<Device const*, size_t> cache;
+    return CountAllPathsRecursive(begin, end, cache);
+}
+
+class Solution : public Day
+{
+public:
+    void Parse(std::string_view input) override
+    {
+        m_Database = ReadInput(input);
+    }
+
+    // Snapshot : the device graph, rebuilt without looking any name up
+    uint32_t GetCacheLayout() const override { return 1; }
+
+    void SaveParsed(CacheWriter& writer) const override
+    {
+        m_Database.Save(writer);
+    }
+
+    bool LoadParsed(CacheReader& reader) override
+    {
+        return m_Database.Load(reader);
+    }
+
+    std::optional<std::string> Part1() override
+    {
+        Device const* you = m_Database.Find("you");
+        Device const* svr = m_Database.Find("svr");
+        Device const* out = m_Database.Find("out");
+        Device const* fft = m_Database.Find("fft");
+        Device const* dac = m_Database.Find("dac");
+
+        AOC_LOG_DEBUG("Finding all paths");
+        AOC_LOG_DEBUG("You -> Out = " << CountAllPathsRecursive(you, out) << " excpecting 670 from AOC22");
+
+        size_t sd = CountAllPathsRecursive(svr, dac); AOC_LOG_DEBUG(" sd = " << sd);
+        size_t df = CountAllPathsRecursive(dac, fft); AOC_LOG_DEBUG(" df = " << df);
+        size_t fo = CountAllPathsRecursive(fft, out); AOC_LOG_DEBUG(" fo = " << fo);
+
+        size_t sf = CountAllPathsRecursive(svr, fft); AOC_LOG_DEBUG(" sf = " << sf);
+        size_t fd = CountAllPathsRecursive(fft, dac); AOC_LOG_DEBUG(" fd = " << fd);
+        size_t dO = CountAllPathsRecursive(dac, out); AOC_LOG_DEBUG(" dO = " << dO);
+
+        return std::to_string(sd * df * fo + sf * fd * dO);
+    }
+
+private:
+    DeviceDatabase m_Database;
+};
+
+} // namespace AOC23
+
+AOC_REGISTER_DAY(AOC23, AOC23::Solution);
@@ -0,0 +1,20 @@
+
+#include <string_view>
+
+#include "Common/Day.h"
+
+namespace AOC24
+{
+
+// Not solved yet, registered so every tool already lists the day
+class Solution : public Day
+{
+public:
+    void Parse(std::string_view /*input*/) override
+    {
+    }
+};
+
+} // namespace AOC24
+
+AOC_REGISTER_DAY_FLAGS(AOC24, AOC24::Solution, DayFlag_Placeholder);
@@ -0,0 +1,132 @@
+#include "InvalidIDs.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <iostream>
+
+#include "Common/InputFile.h"
+#include "Common/Log.h"
+#include "Common/Scanner.h"
+#include "Common/ThreadPool.h"
+
+namespace AOC3
+{
+
+namespace
+{
+    // h + (h + 1) + ... + last, modulo 2^64 : the even one of the two factors is halved before multiplying
+    uint64_t SumRun(uint64_t first, uint64_t last)
+    {
+        uint64_t count = last - first + 1;
+        uint64_t ends = first + last;
+        return (count % 2 == 0) ? (count / 2) * ends : count * (ends / 2);
+    }
+}
+
+std::vector<IDRange> ReadInput(std::string_view input)
+{
+    std::vector<IDRange> result;
+
+    Tokenizer ranges(input, ',');
+    std::string_view rangeString;
+    while (ranges.Next(rangeString))
+    {
+        Scanner scanner(rangeString);
+        IDRange& range = result.emplace_back();
+
+        [[maybe_unused]] bool valid = scanner.ReadNext(range.Min) && scanner.Skip('-') && scanner.Read(range.Max);
+        assert(valid);
+    }
+
+    return result;
+}
+
+bool IsInvalid(uint64_t id)
+{
+    std::string string = std::to_string(id);
+    // string has odd number of digits
+    if (string.size() & 0x1) return false;
+
+    size_t left = 0;
+    size_t right = string.size() / 2;
+    for (; right < string.size(); right++, left++)
+    {
+        char leftChar = string.at(left);
+        char rightChar = string.at(right);
+        if (leftChar != rightChar)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+uint64_t SumInvalidIDs(IDRange const& range)
+{
+    uint64_t sum = 0;
+
+    // h of k digits in [firstHalf, 10 * firstHalf), up to 20 digits IDs : the largest ones fit a uint64_t
+    uint64_t firstHalf = 1;
+    for (uint64_t digits = 1; digits <= 10; digits++, firstHalf *= 10)
+    {
+        uint64_t lastHalf = firstHalf * 10 - 1;
+        uint64_t multiplier = lastHalf + 2; // 10^k + 1
+
+        uint64_t first = std::max(firstHalf, range.Min / multiplier + (range.Min % multiplier != 0));
+        uint64_t last = std::min(lastHalf, range.Max / multiplier);
+        if (first > last) continue;
+
+        AOC_LOG_TRACE("\t" << last - first + 1 << " invalid IDs of " << 2 * digits << " digits, from " << first * multiplier << " to " << last * multiplier);
+        sum += SumRun(first, last) * multiplier;
+    }
+
+    return sum;
+}
+
+uint64_t SumInvalidIDsByScan(IDRange const& range)
+{
+    uint64_t sum = 0;
+    for (uint64_t id = range.Min; id <= range.Max; id++)
+    {
+        if (IsInvalid(id))
+        {
+            AOC_LOG_TRACE("\tInvalid ID " << id << " found");
+            sum += id;
+        }
+        if (id == range.Max) break; // id++ would wrap on the largest ID
+    }
+    return sum;
+}
+
+int RunVerify(std::string const& inputPath)
+{
+    InputFile input(inputPath);
+    if (!input.IsOpen())
+    {
+        std::cerr << "Unable to open " << inputPath << "\n";
+        return 1;
+    }
+
+    std::vector<IDRange> ranges = ReadInput(input.GetData());
+
+    // One range per task, their sizes vary too much for bigger chunks
+    std::vector<uint64_t> scanned(ranges.size());
+    ParallelFor(0, ranges.size(), 1, [&](size_t index) { scanned[index] = SumInvalidIDsByScan(ranges[index]); });
+
+    size_t mismatches = 0;
+    for (size_t index = 0; index < ranges.size(); index++)
+    {
+        uint64_t generated = SumInvalidIDs(ranges[index]);
+        if (generated == scanned[index]) continue;
+
+        std::cout << "Range " << ranges[index].Min << "-" << ranges[index].Max << " : " << generated << " generated, " << scanned[index] << " scanned\n";
+        mismatches++;
+    }
+
+    std::cout << ranges.size() - mismatches << " of " << ranges.size() << " ranges match\n";
+    return mismatches == 0 ? 0 : 1;
+}
+
+} // namespace AOC3
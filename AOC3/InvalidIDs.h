@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace AOC3
+{
+
+struct IDRange
+{
+    uint64_t Min;
+    uint64_t Max;
+};
+
+std::vector<IDRange> ReadInput(std::string_view input);
+
+// An ID is invalid when it is a sequence of digits written twice : 55, 6464, 123123
+bool IsInvalid(uint64_t id);
+
+// Sum of the invalid IDs of range, without going through them : the invalid IDs of 2k digits are h * (10^k + 1)
+// for every h of k digits, so those inside the range are a run of h summed as an arithmetic series. O(digits).
+// Wraps around like any uint64_t sum.
+uint64_t SumInvalidIDs(IDRange const& range);
+
+// Same sum checking every ID of the range with IsInvalid, the reference SumInvalidIDs is verified against
+uint64_t SumInvalidIDsByScan(IDRange const& range);
+
+// Entry point of AOC3's --verify mode : compares both sums on every range of inputPath, returns 1 on any mismatch
+int RunVerify(std::string const& inputPath);
+
+} // namespace AOC3
@@ -0,0 +1,193 @@
+#include "InvalidIDs.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <iostream>
+
+#include "Common/InputFile.h"
+#include "Common/Log.h"
+#include "Common/Scanner.h"
+#include "Common/ThreadPool.h"
+
+namespace AOC4
+{
+
+namespace
+{
+    constexpr uint64_t K_MAX_DIGITS = 20; // The largest uint64_t has 20 digits
+
+    // 0 when n has a square factor, otherwise -1 or 1 for an odd or even number of prime factors
+    int Mobius(uint64_t n)
+    {
+        int result = 1;
+        for (uint64_t prime = 2; prime * prime <= n; prime++)
+        {
+            if (n % prime != 0) continue;
+
+            n /= prime;
+            if (n % prime == 0) return 0;
+            result = -result;
+        }
+        return n > 1 ? -result : result;
+    }
+
+    // h + (h + 1) + ... + last, modulo 2^64 : the even one of the two factors is halved before multiplying
+    uint64_t SumRun(uint64_t first, uint64_t last)
+    {
+        uint64_t count = last - first + 1;
+        uint64_t ends = first + last;
+        return (count % 2 == 0) ? (count / 2) * ends : count * (ends / 2);
+    }
+
+    // The IDs of digits digits made of a block of stride digits repeated, within range
+    InvalidIDs FindRepeating(IDRange const& range, uint64_t digits, uint64_t stride)
+    {
+        uint64_t firstBlock = 1;
+        for (uint64_t digit = 1; digit < stride; digit++) firstBlock *= 10;
+        uint64_t lastBlock = firstBlock * 10 - 1;
+
+        // 1 + 10^stride + ... + 10^(digits - stride), every power fits
+        uint64_t multiplier = 0;
+        for (uint64_t block = 0; block < digits / stride; block++) multiplier = multiplier * (lastBlock + 1) + 1;
+
+        uint64_t first = std::max(firstBlock, range.Min / multiplier + (range.Min % multiplier != 0));
+        uint64_t last = std::min(lastBlock, range.Max / multiplier);
+        if (first > last) return {};
+
+        return { last - first + 1, SumRun(first, last) * multiplier };
+    }
+}
+
+std::vector<IDRange> ReadInput(std::string_view input)
+{
+    std::vector<IDRange> result;
+
+    Tokenizer ranges(input, ',');
+    std::string_view rangeString;
+    while (ranges.Next(rangeString))
+    {
+        Scanner scanner(rangeString);
+        IDRange& range = result.emplace_back();
+
+        [[maybe_unused]] bool valid = scanner.ReadNext(range.Min) && scanner.Skip('-') && scanner.Read(range.Max);
+        assert(valid);
+    }
+
+    return result;
+}
+
+bool IsRepeating(std::string_view string, size_t stride)
+{
+    if (string.size() % stride != 0) return false;
+
+    std::string_view pattern = string.substr(0, stride);
+    for (size_t offset = stride; offset + stride <= string.size(); offset += stride)
+    {
+        std::string_view part = string.substr(offset, stride);
+        if (pattern != part)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool IsInvalid(uint64_t id)
+{
+    std::string string = std::to_string(id);
+
+    for (size_t stride = 1; stride <= string.size() / 2; stride++)
+    {
+        if (IsRepeating(string, stride))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+InvalidIDs FindInvalidIDs(IDRange const& range)
+{
+    InvalidIDs result;
+
+    // Invalid IDs of L digits = union over the primes q dividing L of the IDs repeating L / q digits
+    //                         = - sum over d > 1 dividing L of mobius(d) * IDs repeating L / d digits
+    for (uint64_t digits = 2; digits <= K_MAX_DIGITS; digits++)
+    {
+        for (uint64_t repeats = 2; repeats <= digits; repeats++)
+        {
+            if (digits % repeats != 0) continue;
+
+            int mobius = Mobius(repeats);
+            if (mobius == 0) continue;
+
+            InvalidIDs repeating = FindRepeating(range, digits, digits / repeats);
+            if (repeating.Count == 0) continue;
+
+            AOC_LOG_TRACE("\t" << repeating.Count << " IDs of " << digits << " digits repeating " << digits / repeats << " digits, " << (mobius < 0 ? "added" : "removed"));
+            if (mobius < 0)
+            {
+                result.Count += repeating.Count;
+                result.Sum += repeating.Sum;
+            }
+            else
+            {
+                result.Count -= repeating.Count;
+                result.Sum -= repeating.Sum;
+            }
+        }
+    }
+
+    return result;
+}
+
+InvalidIDs FindInvalidIDsByScan(IDRange const& range)
+{
+    InvalidIDs result;
+    for (uint64_t id = range.Min; id <= range.Max; id++)
+    {
+        if (IsInvalid(id))
+        {
+            AOC_LOG_TRACE("\tInvalid ID " << id << " found");
+            result.Count++;
+            result.Sum += id;
+        }
+        if (id == range.Max) break; // id++ would wrap on the largest ID
+    }
+    return result;
+}
+
+int RunVerify(std::string const& inputPath)
+{
+    InputFile input(inputPath);
+    if (!input.IsOpen())
+    {
+        std::cerr << "Unable to open " << inputPath << "\n";
+        return 1;
+    }
+
+    std::vector<IDRange> ranges = ReadInput(input.GetData());
+
+    // One range per task, their sizes vary too much for bigger chunks
+    std::vector<InvalidIDs> scanned(ranges.size());
+    ParallelFor(0, ranges.size(), 1, [&](size_t index) { scanned[index] = FindInvalidIDsByScan(ranges[index]); });
+
+    size_t mismatches = 0;
+    for (size_t index = 0; index < ranges.size(); index++)
+    {
+        InvalidIDs generated = FindInvalidIDs(ranges[index]);
+        if (generated.Count == scanned[index].Count && generated.Sum == scanned[index].Sum) continue;
+
+        std::cout << "Range " << ranges[index].Min << "-" << ranges[index].Max << " : " << generated.Count << " IDs summing to " << generated.Sum
+                  << " generated, " << scanned[index].Count << " summing to " << scanned[index].Sum << " scanned\n";
+        mismatches++;
+    }
+
+    std::cout << ranges.size() - mismatches << " of " << ranges.size() << " ranges match\n";
+    return mismatches == 0 ? 0 : 1;
+}
+
+} // namespace AOC4
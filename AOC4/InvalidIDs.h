@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace AOC4
+{
+
+struct IDRange
+{
+    uint64_t Min;
+    uint64_t Max;
+};
+
+struct InvalidIDs
+{
+    uint64_t Count = 0;
+    uint64_t Sum = 0; // Wraps around like any uint64_t sum
+};
+
+std::vector<IDRange> ReadInput(std::string_view input);
+
+bool IsRepeating(std::string_view string, size_t stride);
+
+// An ID is invalid when it is a sequence of digits written at least twice : 55, 646464, 123123
+bool IsInvalid(uint64_t id);
+
+// Invalid IDs of range, without going through them. For L digits, the IDs repeating a block of p digits (p divides L)
+// are h * (1 + 10^p + ... + 10^(L - p)) for every h of p digits, a run of h summed as an arithmetic series.
+// An ID repeating blocks of p and q digits also repeats blocks of gcd(p, q), so the runs of the strides L / d
+// are combined by inclusion-exclusion with the Möbius function of d. O(digits * divisors).
+InvalidIDs FindInvalidIDs(IDRange const& range);
+
+// Same IDs checking every ID of the range with IsInvalid, the reference FindInvalidIDs is verified against
+InvalidIDs FindInvalidIDsByScan(IDRange const& range);
+
+// Entry point of AOC4's --verify mode : compares both on every range of inputPath, returns 1 on any mismatch
+int RunVerify(std::string const& inputPath);
+
+} // namespace AOC4
@@ -0,0 +1,42 @@
+#include "InvalidIDs.h"
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Common/Day.h"
+#include "Common/Log.h"
+
+namespace AOC4
+{
+
+class Solution : public Day
+{
+public:
+    void Parse(std::string_view input) override
+    {
+        m_Ranges = ReadInput(input);
+    }
+
+    std::optional<std::string> Part1() override
+    {
+        uint64_t invalidIDsum = 0;
+        for (IDRange const& range : m_Ranges)
+        {
+            AOC_LOG_TRACE("Range(" << range.Min << ", " << range.Max << ")");
+            invalidIDsum += FindInvalidIDs(range).Sum;
+        }
+
+        return std::to_string(invalidIDsum);
+    }
+
+private:
+    std::vector<IDRange> m_Ranges;
+};
+
+} // namespace AOC4
+
+AOC_REGISTER_DAY(AOC4, AOC4::Solution);
@@ -0,0 +1,83 @@
+
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "Common/Day.h"
+#include "Common/Log.h"
+#include "Common/Pipeline.h"
+#include "Common/Scanner.h"
+
+namespace AOC5
+{
+
+uint64_t GetBestJoltableInBank(std::string_view bank)
+{
+    std::string result = std::string(bank.substr(0, 2));
+
+    for (size_t index = 2; index < bank.size(); index++)
+    {
+        bool last = index + 1 == bank.size();
+
+        if (result.at(0) < bank.at(index) && !last)
+        {
+            result.at(0) = bank.at(index);
+            result.at(1) = bank.at(index + 1);
+            continue;
+        }
+
+        if (result.at(1) < bank.at(index))
+        {
+            result.at(1) = bank.at(index);
+        }
+    }
+
+    return ParseInteger<uint64_t>(result);
+}
+
+class Solution : public Day
+{
+public:
+    void Parse(std::string_view input) override
+    {
+        // Banks are streamed to the solvers by Part1
+        m_Input = input;
+    }
+
+    bool Reset() override
+    {
+        m_Input = {};
+        return true;
+    }
+
+    std::optional<std::string> Part1() override
+    {
+        std::vector<SolverSlot<uint64_t>> joltages(GetPipelineSolverCount());
+        StreamLines<std::string_view>(m_Input,
+            [](std::string_view line, std::string_view& bank) { bank = line; return true; },
+            [&joltages](size_t solver, std::string_view bank)
+            {
+                auto joltage = GetBestJoltableInBank(bank);
+                AOC_LOG_TRACE("Best Joltable in " << bank << " : " << joltage);
+                joltages[solver].Value += joltage;
+            },
+            joltages.size());
+
+        uint64_t totalJoltage = 0;
+        for (auto const& joltage : joltages) totalJoltage += joltage.Value;
+
+        return std::to_string(totalJoltage);
+    }
+
+private:
+    std::string_view m_Input;
+};
+
+} // namespace AOC5
+
+AOC_REGISTER_DAY(AOC5, AOC5::Solution);
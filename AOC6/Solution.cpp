@@ -0,0 +1,93 @@
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Common/Day.h"
+#include "Common/Log.h"
+#include "Common/Pipeline.h"
+#include "Common/Scanner.h"
+
+namespace AOC6
+{
+
+size_t FindBestBatteryIndex(std::string_view bank)
+{
+    size_t best = 0;
+    for (size_t current = 1; current < bank.size(); current++)
+    {
+        if (bank[best] < bank[current])
+        {
+            best = current;
+        }
+    }
+
+    return best;
+}
+
+uint64_t GetBestJoltableInBank(std::string_view bank, size_t batteryCount)
+{
+    std::string selection;
+    selection.reserve( batteryCount);
+
+    size_t begin = 0;
+    while (selection.size() < batteryCount)
+    {
+        // We need space to find other battery indices
+        size_t reservedSpace = batteryCount - (selection.size() + 1);
+        size_t end = bank.size() - reservedSpace;
+        std::string_view searchArea = bank.substr(begin, end - begin);
+        size_t bestBatteryIndex = FindBestBatteryIndex(searchArea);
+
+        selection.push_back(searchArea.at(bestBatteryIndex));
+        begin += bestBatteryIndex + 1;
+    }
+
+    return ParseInteger<uint64_t>(selection);
+}
+
+class Solution : public Day
+{
+public:
+    void Parse(std::string_view input) override
+    {
+        // Banks are streamed to the solvers by Part1
+        m_Input = input;
+    }
+
+    bool Reset() override
+    {
+        m_Input = {};
+        return true;
+    }
+
+    std::optional<std::string> Part1() override
+    {
+        std::vector<SolverSlot<uint64_t>> joltages(GetPipelineSolverCount());
+        StreamLines<std::string_view>(m_Input,
+            [](std::string_view line, std::string_view& bank) { bank = line; return true; },
+            [&joltages](size_t solver, std::string_view bank)
+            {
+                AOC_LOG_TRACE("Bank : " << bank);
+                auto joltage = GetBestJoltableInBank(bank, 12);
+                AOC_LOG_TRACE("Best Batteries : " << joltage);
+                joltages[solver].Value += joltage;
+            },
+            joltages.size());
+
+        uint64_t totalJoltage = 0;
+        for (auto const& joltage : joltages) totalJoltage += joltage.Value;
+
+        return std::to_string(totalJoltage);
+    }
+
+private:
+    std::string_view m_Input;
+};
+
+} // namespace AOC6
+
+AOC_REGISTER_DAY(AOC6, AOC6::Solution);
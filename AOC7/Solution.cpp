@@ -0,0 +1,83 @@
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "Common/Day.h"
+#include "Common/Grid.h"
+#include "Common/Log.h"
+
+namespace AOC7
+{
+
+// A border of empty cells lets the neighbour lookups skip the bounds checks
+using Matrix2D = Grid<char>;
+
+void ReadInput(std::string_view input, Matrix2D& matrix)
+{
+    matrix = ParseCharGrid(input, 1, '.');
+}
+
+bool CanUseForklift(Matrix2D const& matrix, int64_t x, int64_t y)
+{
+    uint64_t obstacles = 0;
+    for (int dy = -1; dy <= 1; dy++)
+    {
+        for (int dx = -1; dx <= 1; dx++)
+        {
+            if (dx == 0 && dy == 0) continue;
+            if (matrix.At(x + dx, y + dy) == '@') obstacles++;
+        }
+    }
+
+    return obstacles < 4;
+}
+
+std::string DebugDraw(Matrix2D const& matrix)
+{
+    std::string drawing;
+    for (size_t y = 0; y < matrix.GetHeight(); y++)
+    {
+        drawing += '\n';
+        for (char cell : matrix.GetRow(y))
+        {
+            drawing += cell;
+        }
+    }
+
+    return drawing;
+}
+
+class Solution : public Day
+{
+public:
+    void Parse(std::string_view input) override
+    {
+        ReadInput(input, m_Matrix);
+    }
+
+    std::optional<std::string> Part1() override
+    {
+        AOC_LOG_DEBUG("Matrix :" << DebugDraw(m_Matrix));
+        uint64_t moveableCount = 0;
+        for (int64_t y = 0; y < static_cast<int64_t>(m_Matrix.GetHeight()); y++)
+        {
+            for (int64_t x = 0; x < static_cast<int64_t>(m_Matrix.GetWidth()); x++)
+            {
+                if (m_Matrix.At(x, y) == '.') continue;;
+                if (CanUseForklift(m_Matrix, x, y)) moveableCount++;
+            }
+        }
+
+        return std::to_string(moveableCount);
+    }
+
+private:
+    Matrix2D m_Matrix;
+};
+
+} // namespace AOC7
+
+AOC_REGISTER_DAY(AOC7, AOC7::Solution);
@@ -0,0 +1,96 @@
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "Common/Day.h"
+#include "Common/Grid.h"
+
+namespace AOC8
+{
+
+// A border of empty cells lets the neighbour lookups skip the bounds checks
+using Matrix2D = Grid<char>;
+
+void ReadInput(std::string_view input, Matrix2D& matrix)
+{
+    matrix = ParseCharGrid(input, 1, '.');
+}
+
+bool CanUseForklift(Matrix2D const& matrix, int64_t x, int64_t y)
+{
+    uint64_t obstacles = 0;
+    for (int dy = -1; dy <= 1; dy++)
+    {
+        for (int dx = -1; dx <= 1; dx++)
+        {
+            if (dx == 0 && dy == 0) continue;
+            if (matrix.At(x + dx, y + dy) == '@') obstacles++;
+        }
+    }
+
+    return obstacles < 4;
+}
+
+uint64_t CleanUpWithForklift(Matrix2D& matrix)
+{
+    uint64_t removed = 0;
+    for (int64_t y = 0; y < static_cast<int64_t>(matrix.GetHeight()); y++)
+    {
+        for (int64_t x = 0; x < static_cast<int64_t>(matrix.GetWidth()); x++)
+        {
+            if (matrix.At(x, y) == '.') continue;
+            if (!CanUseForklift(matrix, x, y)) continue;
+            matrix.At(x, y) = '.';
+            removed++;
+        }
+    }
+
+    return removed;
+}
+
+std::string DebugDraw(Matrix2D const& matrix)
+{
+    std::string drawing;
+    for (size_t y = 0; y < matrix.GetHeight(); y++)
+    {
+        drawing += '\n';
+        for (char cell : matrix.GetRow(y))
+        {
+            drawing += cell;
+        }
+    }
+
+    return drawing;
+}
+
+class Solution : public Day
+{
+public:
+    void Parse(std::string_view input) override
+    {
+        ReadInput(input, m_Matrix);
+    }
+
+    std::optional<std::string> Part1() override
+    {
+        // Cleaning up is destructive, work on a copy to keep the parsed state intact
+        Matrix2D matrix = m_Matrix;
+        uint64_t total = 0;
+        while (uint64_t removed = CleanUpWithForklift(matrix))
+        {
+            total += removed;
+        }
+
+        return std::to_string(total);
+    }
+
+private:
+    Matrix2D m_Matrix;
+};
+
+} // namespace AOC8
+
+AOC_REGISTER_DAY(AOC8, AOC8::Solution);
@@ -0,0 +1,132 @@
+
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Common/Day.h"
+#include "Common/InputFile.h"
+#include "Common/Log.h"
+#include "Common/Pipeline.h"
+#include "Common/Scanner.h"
+
+namespace AOC9
+{
+
+class FreshIDRange
+{
+public:
+    FreshIDRange(uint64_t min, uint64_t max) : m_Min(min), m_Max(max)
+    {
+    }
+
+    bool IsFresh(uint64_t id) const
+    {
+        return id >= m_Min && id <= m_Max;
+    }
+
+private:
+    uint64_t m_Min;
+    uint64_t m_Max;
+};
+
+class Database
+{
+public:
+    void AddFreshIDRange(uint64_t min, uint64_t max)
+    {
+        m_FreshIDRanges.emplace_back(min, max);
+    }
+
+    void Clear()
+    {
+        m_FreshIDRanges.clear();
+    }
+
+    bool IsFresh(uint64_t id) const
+    {
+        for (auto const& range : m_FreshIDRanges)
+        {
+            if (range.IsFresh(id))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+private:
+    std::vector<FreshIDRange> m_FreshIDRanges;
+};
+
+// Loads the database, the available IDs are returned as is to be streamed
+std::string_view ReadInput(std::string_view input, Database& db)
+{
+    Tokenizer lines(input);
+    std::string_view line;
+
+    // Load Database
+    while (lines.Next(line))
+    {
+        if (line.empty()) break;
+
+        Scanner scanner(line);
+        uint64_t min = 0, max = 0;
+        [[maybe_unused]] bool valid = scanner.Read(min) && scanner.Skip('-') && scanner.Read(max);
+        assert(valid);
+        db.AddFreshIDRange(min, max);
+    }
+
+    return lines.GetRemaining();
+}
+
+class Solution : public Day
+{
+public:
+    void Parse(std::string_view input) override
+    {
+        m_IDs = ReadInput(input, m_Database);
+    }
+
+    bool Reset() override
+    {
+        m_Database.Clear();
+        m_IDs = {};
+        return true;
+    }
+
+    std::optional<std::string> Part1() override
+    {
+        std::vector<SolverSlot<uint64_t>> freshCounts(GetPipelineSolverCount());
+        StreamLines<uint64_t>(m_IDs,
+            [](std::string_view line, uint64_t& id) { id = ParseInteger<uint64_t>(line); return true; },
+            [this, &freshCounts](size_t solver, uint64_t id)
+            {
+                bool fresh = m_Database.IsFresh(id);
+                AOC_LOG_TRACE("ID " << id << " : " << (fresh ? "Fresh" : "Spoiled"));
+
+                if (fresh)
+                {
+                    freshCounts[solver].Value++;
+                }
+            },
+            freshCounts.size());
+
+        uint64_t freshCount = 0;
+        for (auto const& count : freshCounts) freshCount += count.Value;
+
+        return std::to_string(freshCount);
+    }
+
+private:
+    Database m_Database;
+    std::string_view m_IDs; // One per line, streamed to the solvers by Part1
+};
+
+} // namespace AOC9
+
+AOC_REGISTER_DAY(AOC9, AOC9::Solution);
@@ -0,0 +1,257 @@
+#include "DialBenchmark.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "AOC1/Dial.h"
+#include "AOC1/DialBank.h"
+#include "AOC2/Dial.h"
+
+namespace
+{
+    struct Rotation
+    {
+        char Direction;
+        uint64_t Count;
+    };
+
+    struct DialResult
+    {
+        uint64_t Index = 0;
+        uint64_t ZCount = 0;
+
+        bool operator==(DialResult const& other) const { return Index == other.Index && ZCount == other.ZCount; }
+    };
+
+    // AOC1's Dial with its modulus only known at run time : the count's modulo is a division
+    class RuntimeDial
+    {
+    public:
+        RuntimeDial(uint64_t modulus, uint64_t start)
+            : m_Modulus(modulus)
+            , m_Index(start)
+        {
+        }
+
+        void Rotate(bool left, uint64_t count)
+        {
+            count %= m_Modulus;
+            uint64_t next = m_Index + count + left * (m_Modulus - 2 * count);
+            m_Index = next - (m_Modulus & (0 - static_cast<uint64_t>(next >= m_Modulus)));
+        }
+
+        uint64_t GetIndex() const { return m_Index; }
+
+    private:
+        uint64_t m_Modulus;
+        uint64_t m_Index;
+    };
+
+    template<uint64_t Modulus>
+    uint64_t CountLandings(std::vector<Rotation> const& log)
+    {
+        using Dial = AOC1::Dial<Modulus, 50>;
+
+        Dial dial;
+        uint64_t landings = 0;
+        for (Rotation const& rotation : log)
+        {
+            dial.Rotate(rotation.Direction == 'L' ? Dial::Direction::Left : Dial::Direction::Right, rotation.Count);
+            if (dial.GetIndex() == 0) landings++;
+        }
+        return landings;
+    }
+
+    uint64_t CountLandings(std::vector<Rotation> const& log, uint64_t modulus)
+    {
+        RuntimeDial dial(modulus, 50);
+        uint64_t landings = 0;
+        for (Rotation const& rotation : log)
+        {
+            dial.Rotate(rotation.Direction == 'L', rotation.Count);
+            if (dial.GetIndex() == 0) landings++;
+        }
+        return landings;
+    }
+
+    template<typename Function, typename Result>
+    uint64_t GetMedianNs(size_t iterations, Function&& function, Result& result)
+    {
+        std::vector<uint64_t> samples;
+        for (size_t iteration = 0; iteration < iterations; iteration++)
+        {
+            auto begin = std::chrono::steady_clock::now();
+            result = function();
+            auto end = std::chrono::steady_clock::now();
+            samples.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count());
+        }
+
+        std::sort(samples.begin(), samples.end());
+        return samples.at((samples.size() - 1) / 2);
+    }
+}
+
+bool RunDialBenchmark(std::ostream& stream, uint64_t maxCount, size_t iterations)
+{
+    constexpr size_t K_ROTATIONS = 4096; // As many as the real input
+
+    // Counts spread evenly over their magnitude, so the log mixes the puzzle's short turns with huge ones
+    std::mt19937_64 random(42);
+    std::bernoulli_distribution left(0.5);
+    std::uniform_real_distribution<double> magnitude(0.0, std::log(static_cast<double>(maxCount)));
+
+    std::vector<Rotation> log;
+    uint64_t clicks = 0;
+    for (size_t index = 0; index < K_ROTATIONS; index++)
+    {
+        uint64_t count = std::clamp<uint64_t>(static_cast<uint64_t>(std::exp(magnitude(random))), 1, maxCount);
+        log.push_back({ left(random) ? 'L' : 'R', count });
+        clicks += count;
+    }
+
+    auto rotateAll = [&](auto rotate) {
+        AOC2::DialThatZCounts<> dial;
+        for (Rotation const& rotation : log)
+        {
+            rotate(dial, rotation);
+        }
+        return DialResult{ dial.GetIndex(), dial.GetZCount() };
+    };
+
+    DialResult results[2];
+    uint64_t timings[2] = {
+        GetMedianNs(iterations, [&]() { return rotateAll([](AOC2::DialThatZCounts<>& dial, Rotation const& rotation) { dial.RotateByClicks(rotation.Direction, rotation.Count); }); }, results[0]),
+        GetMedianNs(iterations, [&]() { return rotateAll([](AOC2::DialThatZCounts<>& dial, Rotation const& rotation) { dial.Rotate(rotation.Direction, rotation.Count); }); }, results[1]),
+    };
+    char const* const names[2] = { "clicks", "closed form" };
+
+    stream << "Synthetic log of " << K_ROTATIONS << " rotations, counts up to " << maxCount << " (" << clicks << " clicks), AOC2 dial, median of " << iterations << " runs\n";
+    stream << std::left << std::setw(12) << "Rotation" << std::right << std::setw(14) << "Median" << std::setw(16) << "Mrotations/s" << std::setw(8) << "Index" << std::setw(16) << "Zeros" << "\n";
+    stream << std::fixed << std::setprecision(3);
+    for (size_t index = 0; index < 2; index++)
+    {
+        double rotationsPerSecond = timings[index] ? K_ROTATIONS / (timings[index] * 1e-9) : 0.0;
+        stream << std::left << std::setw(12) << names[index] << std::right << std::setw(12) << timings[index] * 1e-6 << "ms"
+               << std::setw(16) << rotationsPerSecond * 1e-6 << std::setw(8) << results[index].Index << std::setw(16) << results[index].ZCount << "\n";
+    }
+
+    if (!(results[0] == results[1]))
+    {
+        stream << "Mismatch : the closed form disagrees with the click by click rotation\n";
+        return false;
+    }
+    return true;
+}
+
+bool RunDialBankBenchmark(std::ostream& stream, size_t lockCount, size_t iterations)
+{
+    constexpr size_t K_ROTATIONS = 1024; // Per lock
+
+    // Rotations like the real input's, one row of a step per lock for each of them
+    std::mt19937_64 random(42);
+    std::bernoulli_distribution left(0.5);
+    std::uniform_int_distribution<uint64_t> count(1, 999);
+    std::vector<uint16_t> steps(K_ROTATIONS * lockCount);
+    for (uint16_t& step : steps)
+    {
+        step = AOC1::DialBank::GetStep(left(random) ? 'L' : 'R', count(random));
+    }
+
+    // One lock after the other, the way AOC1's Dial turns : 64 bits index and a modulo per rotation
+    std::vector<uint64_t> lockHits(lockCount);
+    auto rotateEach = [&]() {
+        uint64_t total = 0;
+        for (size_t lock = 0; lock < lockCount; lock++)
+        {
+            uint64_t index = 50;
+            uint64_t hits = 0;
+            for (size_t row = 0; row < K_ROTATIONS; row++)
+            {
+                index = (index + steps[row * lockCount + lock]) % 100;
+                if (index == 0) hits++;
+            }
+            lockHits[lock] = hits;
+            total += hits;
+        }
+        return total;
+    };
+
+    std::vector<uint64_t> bankHits(lockCount);
+    auto rotateBank = [&]() {
+        AOC1::DialBank bank(lockCount);
+        bank.Rotate(steps);
+        for (size_t lock = 0; lock < lockCount; lock++) bankHits[lock] = bank.GetZeroHits(lock);
+        return bank.GetTotalZeroHits();
+    };
+
+    uint64_t results[2] = {};
+    uint64_t timings[2] = {
+        GetMedianNs(iterations, rotateEach, results[0]),
+        GetMedianNs(iterations, rotateBank, results[1]),
+    };
+    std::string const names[2] = { "each", std::string("bank ") + AOC1::DialBank::GetKernelName() };
+
+    stream << "Synthetic " << lockCount << " locks of " << K_ROTATIONS << " rotations each, AOC1 dial, median of " << iterations << " runs\n";
+    stream << std::left << std::setw(14) << "Locks" << std::right << std::setw(12) << "Median" << std::setw(16) << "Mrotations/s" << std::setw(12) << "Zero hits" << "\n";
+    stream << std::fixed << std::setprecision(3);
+    for (size_t index = 0; index < 2; index++)
+    {
+        double rotationsPerSecond = timings[index] ? (lockCount * K_ROTATIONS) / (timings[index] * 1e-9) : 0.0;
+        stream << std::left << std::setw(14) << names[index] << std::right << std::setw(10) << timings[index] * 1e-6 << "ms"
+               << std::setw(16) << rotationsPerSecond * 1e-6 << std::setw(12) << results[index] << "\n";
+    }
+
+    if (lockHits != bankHits)
+    {
+        stream << "Mismatch : the bank disagrees with the locks turned one by one\n";
+        return false;
+    }
+    return true;
+}
+
+bool RunDialModulusBenchmark(std::ostream& stream, size_t rotationCount, size_t iterations)
+{
+    // Rotations like the real input's
+    std::mt19937_64 random(42);
+    std::bernoulli_distribution left(0.5);
+    std::uniform_int_distribution<uint64_t> count(1, 999);
+    std::vector<Rotation> log;
+    for (size_t index = 0; index < rotationCount; index++)
+    {
+        log.push_back({ left(random) ? 'L' : 'R', count(random) });
+    }
+
+    // Read back at run time, so the compiler can't see the moduli of the runtime dials
+    volatile uint64_t runtimeModuli[2] = { 100, 128 };
+
+    uint64_t results[4] = {};
+    uint64_t timings[4] = {
+        GetMedianNs(iterations, [&]() { return CountLandings(log, runtimeModuli[0]); }, results[0]),
+        GetMedianNs(iterations, [&]() { return CountLandings<100>(log); }, results[1]),
+        GetMedianNs(iterations, [&]() { return CountLandings(log, runtimeModuli[1]); }, results[2]),
+        GetMedianNs(iterations, [&]() { return CountLandings<128>(log); }, results[3]),
+    };
+    char const* const names[4] = { "100 runtime", "100 template", "128 runtime", "128 template" };
+
+    stream << "Synthetic log of " << rotationCount << " rotations, AOC1 dial with a runtime or template modulus, median of " << iterations << " runs\n";
+    stream << std::left << std::setw(14) << "Modulus" << std::right << std::setw(12) << "Median" << std::setw(16) << "Mrotations/s" << std::setw(12) << "Landings" << "\n";
+    stream << std::fixed << std::setprecision(3);
+    for (size_t index = 0; index < 4; index++)
+    {
+        double rotationsPerSecond = timings[index] ? rotationCount / (timings[index] * 1e-9) : 0.0;
+        stream << std::left << std::setw(14) << names[index] << std::right << std::setw(10) << timings[index] * 1e-6 << "ms"
+               << std::setw(16) << rotationsPerSecond * 1e-6 << std::setw(12) << results[index] << "\n";
+    }
+
+    if (results[0] != results[1] || results[2] != results[3])
+    {
+        stream << "Mismatch : a template dial disagrees with the runtime one\n";
+        return false;
+    }
+    return true;
+}
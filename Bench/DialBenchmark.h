@@ -0,0 +1,17 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+
+// Times AOC2's closed form dial rotation against the click by click one, on a synthetic log of rotations whose counts
+// go up to maxCount. Returns false when the two disagree on the final position or on the zeros counted.
+bool RunDialBenchmark(std::ostream& stream, uint64_t maxCount, size_t iterations);
+
+// Times AOC1's DialBank against turning its lockCount locks one after the other, on synthetic logs.
+// Returns false when the two disagree on any lock's zero hits.
+bool RunDialBankBenchmark(std::ostream& stream, size_t lockCount, size_t iterations);
+
+// Times AOC1's Dial with a compile time modulus against the same rotations with a modulus only known at run time,
+// for the puzzle's 100 and for a power of two. Returns false when they disagree.
+bool RunDialModulusBenchmark(std::ostream& stream, size_t rotationCount, size_t iterations);
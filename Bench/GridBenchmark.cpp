@@ -0,0 +1,116 @@
+#include "GridBenchmark.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <random>
+#include <vector>
+
+#include "Common/Grid.h"
+
+namespace
+{
+    // The grid layout AOC7/AOC8 used before Grid : bounds checked on every read
+    struct CheckedGrid
+    {
+        std::vector<char> Data;
+        int64_t Width = 0;
+        int64_t Height = 0;
+
+        char At(int64_t x, int64_t y) const
+        {
+            if (x < 0 || x >= Width) return '.';
+            if (y < 0 || y >= Height) return '.';
+            return Data[x + y * Width];
+        }
+    };
+
+    // Counts the cells with less than 4 occupied neighbours, AOC7's kernel
+    template<typename GridType>
+    uint64_t CountAccessible(GridType const& grid, int64_t width, int64_t height)
+    {
+        uint64_t count = 0;
+        for (int64_t y = 0; y < height; y++)
+        {
+            for (int64_t x = 0; x < width; x++)
+            {
+                if (grid.At(x, y) == '.') continue;
+
+                uint64_t obstacles = 0;
+                for (int64_t dy = -1; dy <= 1; dy++)
+                {
+                    for (int64_t dx = -1; dx <= 1; dx++)
+                    {
+                        if (dx == 0 && dy == 0) continue;
+                        if (grid.At(x + dx, y + dy) == '@') obstacles++;
+                    }
+                }
+
+                if (obstacles < 4) count++;
+            }
+        }
+        return count;
+    }
+
+    template<typename Function>
+    uint64_t GetMedianNs(size_t iterations, Function&& function, uint64_t& result)
+    {
+        std::vector<uint64_t> samples;
+        for (size_t iteration = 0; iteration < iterations; iteration++)
+        {
+            auto begin = std::chrono::steady_clock::now();
+            result = function();
+            auto end = std::chrono::steady_clock::now();
+            samples.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count());
+        }
+
+        std::sort(samples.begin(), samples.end());
+        return samples.at((samples.size() - 1) / 2);
+    }
+}
+
+void RunGridBenchmark(std::ostream& stream, size_t size, size_t iterations)
+{
+    int64_t side = static_cast<int64_t>(size);
+
+    CheckedGrid checked;
+    checked.Width = side;
+    checked.Height = side;
+    checked.Data.resize(size * size);
+
+    Grid<char> padded(size, size, '.', 1, '.');
+
+    // Same density of rolls as the real input
+    std::mt19937 random(42);
+    std::bernoulli_distribution occupied(0.6);
+    for (int64_t y = 0; y < side; y++)
+    {
+        for (int64_t x = 0; x < side; x++)
+        {
+            char cell = occupied(random) ? '@' : '.';
+            checked.Data[x + y * side] = cell;
+            padded.At(x, y) = cell;
+        }
+    }
+
+    TransposedGridView<char> transposed(padded);
+
+    uint64_t results[3] = {};
+    uint64_t timings[3] = {
+        GetMedianNs(iterations, [&]() { return CountAccessible(checked, side, side); }, results[0]),
+        GetMedianNs(iterations, [&]() { return CountAccessible(padded, side, side); }, results[1]),
+        GetMedianNs(iterations, [&]() { return CountAccessible(transposed, side, side); }, results[2]),
+    };
+    char const* const names[3] = { "checked", "padded", "transposed" };
+
+    stream << "Synthetic " << size << "x" << size << " grid, AOC7 neighbour count, median of " << iterations << " runs\n";
+    stream << std::left << std::setw(12) << "Layout" << std::right << std::setw(12) << "Median" << std::setw(14) << "Mcells/s" << std::setw(12) << "Result" << "\n";
+    stream << std::fixed << std::setprecision(3);
+    for (size_t index = 0; index < 3; index++)
+    {
+        double cellsPerSecond = timings[index] ? (size * size) / (timings[index] * 1e-9) : 0.0;
+        stream << std::left << std::setw(12) << names[index] << std::right << std::setw(10) << timings[index] * 1e-6 << "ms"
+               << std::setw(14) << cellsPerSecond * 1e-6 << std::setw(12) << results[index] << "\n";
+    }
+}
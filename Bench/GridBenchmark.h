@@ -0,0 +1,8 @@
+#pragma once
+
+#include <cstddef>
+#include <ostream>
+
+// Times AOC7's neighbour lookups on a synthetic size x size grid, with the old bounds checked layout,
+// Grid's sentinel border and a transposed view over it.
+void RunGridBenchmark(std::ostream& stream, size_t size, size_t iterations);
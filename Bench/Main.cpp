@@ -0,0 +1,746 @@
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "DialBenchmark.h"
+#include "GridBenchmark.h"
+#include "PerfCounters.h"
+#include "Scaling.h"
+#include "Common/Allocations.h"
+#include "Common/Day.h"
+#include "Common/InputFile.h"
+#include "Common/Log.h"
+#include "Common/ParseCache.h"
+#include "Common/Scanner.h"
+#include "Common/ThreadPool.h"
+#include "Generator/Generators.h"
+
+enum class Format
+{
+    Text,
+    Json,
+    Csv
+};
+
+struct Options
+{
+    size_t Iterations = 10;
+    size_t Warmup = 2;
+    std::vector<std::string> Days;
+    bool All = false;
+    Format OutputFormat = Format::Text;
+    std::string OutputFile;
+    std::string Root = AOC_SOURCE_DIR;
+    size_t GridSize = 0; // Synthetic grid benchmark instead of the days when set
+    uint64_t DialMaxCount = 0; // Synthetic dial rotations benchmark instead of the days when set
+    size_t DialBankLocks = 0; // Synthetic dial bank benchmark instead of the days when set
+    size_t DialModulusRotations = 0; // Synthetic dial modulus benchmark instead of the days when set
+    bool ParseCache = false; // Time loading the parsed snapshots instead of parsing
+
+    // Complexity scaling mode, on generated inputs instead of the real ones
+    bool Scaling = false;
+    double MinScale = 1.0 / 16.0; // Small enough for the quadratic days to get several samples within the budget
+    double MaxScale = 64.0;
+    uint64_t BudgetMs = 250; // Stop growing a day's input once a run takes longer
+    std::string Baseline;
+    std::string WriteBaseline;
+    ScalingTolerance Tolerance;
+
+    std::string Reference; // csv report of another build to compare against
+
+    size_t Threads = 0; // Thread pool size, 0 is one per hardware thread
+    bool ThreadScaling = false;
+};
+
+struct PhaseStats
+{
+    std::string Name;
+    uint64_t MinNs = 0;
+    uint64_t MedianNs = 0;
+    uint64_t P99Ns = 0;
+    AllocationStats Allocations;
+    PerfSample Counters; // Median of every event
+    std::string Answer;  // Empty for the parse phase
+};
+
+struct DayResult
+{
+    std::string Name;
+    size_t InputBytes = 0;
+    size_t Iterations = 0;
+    std::vector<PhaseStats> Phases; // parse, then every implemented part
+
+    uint64_t GetTotalMedianNs() const
+    {
+        uint64_t total = 0;
+        for (PhaseStats const& phase : Phases) total += phase.MedianNs;
+        return total;
+    }
+
+    double GetThroughput(uint64_t nanoseconds) const
+    {
+        if (nanoseconds == 0) return 0.0;
+        return (InputBytes / (1024.0 * 1024.0)) / (nanoseconds * 1e-9);
+    }
+};
+
+void PrintUsage()
+{
+    std::cout << "Usage : aoc_bench [options]\n"
+              << "  --day <AOCn>[,<AOCn>...]  Only run the given days (repeatable, 'n' alone is accepted)\n"
+              << "  --all                     Also run the slow days (AOC19, AOC22)\n"
+              << "  --iterations <N>          Measured runs per day (default 10)\n"
+              << "  --warmup <N>              Unmeasured runs per day (default 2)\n"
+              << "  --format <text|json|csv>  Report format (default text)\n"
+              << "  --output <file>           Write the report to a file instead of stdout\n"
+              << "  --root <dir>              Repository root holding the AOCn/input.txt files\n"
+              << "  --cache                   Time loading the days' parsed snapshots (see aoc) instead of parsing\n"
+              << "  --grid <N>                Only time the grid layouts on a synthetic NxN grid\n"
+              << "  --dial <N>                Only time AOC2's dial rotations on a synthetic log with counts up to N\n"
+              << "  --dial-bank <N>           Only time AOC1's dial bank on N synthetic locks\n"
+              << "  --dial-modulus <N>        Only time AOC1's dial with runtime and template moduli on N synthetic rotations\n"
+              << "\n"
+              << "  --scaling                 Fit each phase's time to a power law of the input size, on generated inputs\n"
+              << "                            at 1/16x, 1/8x... 1x, 2x... the real puzzle size, slow days included\n"
+              << "  --min-scale <x>           Smallest input size (default 0.0625)\n"
+              << "  --max-scale <N>           Largest input size (default 64, lower for the days whose generator caps it)\n"
+              << "  --budget <ms>             Stop growing a day's input once a run takes longer (default 250)\n"
+              << "  --baseline <file>         Compare against a baseline, exits with 1 when a phase regressed\n"
+              << "  --write-baseline <file>   Record the fits as the new baseline\n"
+              << "  --exponent-tolerance <x>  Allowed increase of an exponent (default 0.3)\n"
+              << "  --time-tolerance <x>      Allowed relative increase of the fitted time (default 1.0, twice as slow)\n"
+              << "  --reference <file>        Report each day's speedup over a csv report of another build\n"
+              << "  --threads <N>             Thread pool size (default one per hardware thread)\n"
+              << "  --thread-scaling          Time each day from 1 thread up to --threads, doubling, and report the speedups\n";
+}
+
+bool ParseOptions(int argc, char** argv, Options& options)
+{
+    for (int index = 1; index < argc; index++)
+    {
+        std::string arg = argv[index];
+        bool hasValue = index + 1 < argc;
+
+        if (arg == "--all")
+        {
+            options.All = true;
+        }
+        else if (arg == "--day" && hasValue)
+        {
+            std::string list = argv[++index];
+            size_t begin = 0;
+            while (begin <= list.size())
+            {
+                size_t end = std::min(list.find(',', begin), list.size());
+                if (end > begin) options.Days.push_back(list.substr(begin, end - begin));
+                begin = end + 1;
+            }
+        }
+        else if (arg == "--iterations" && hasValue)
+        {
+            options.Iterations = std::max<size_t>(1, std::strtoull(argv[++index], nullptr, 10));
+        }
+        else if (arg == "--warmup" && hasValue)
+        {
+            options.Warmup = std::strtoull(argv[++index], nullptr, 10);
+        }
+        else if (arg == "--format" && hasValue)
+        {
+            std::string format = argv[++index];
+            if (format == "text") options.OutputFormat = Format::Text;
+            else if (format == "json") options.OutputFormat = Format::Json;
+            else if (format == "csv") options.OutputFormat = Format::Csv;
+            else return false;
+        }
+        else if (arg == "--output" && hasValue)
+        {
+            options.OutputFile = argv[++index];
+        }
+        else if (arg == "--root" && hasValue)
+        {
+            options.Root = argv[++index];
+        }
+        else if (arg == "--cache")
+        {
+            options.ParseCache = true;
+        }
+        else if (arg == "--grid" && hasValue)
+        {
+            options.GridSize = std::strtoull(argv[++index], nullptr, 10);
+        }
+        else if (arg == "--dial" && hasValue)
+        {
+            options.DialMaxCount = std::strtoull(argv[++index], nullptr, 10);
+        }
+        else if (arg == "--dial-bank" && hasValue)
+        {
+            options.DialBankLocks = std::strtoull(argv[++index], nullptr, 10);
+        }
+        else if (arg == "--dial-modulus" && hasValue)
+        {
+            options.DialModulusRotations = std::strtoull(argv[++index], nullptr, 10);
+        }
+        else if (arg == "--scaling")
+        {
+            options.Scaling = true;
+        }
+        else if (arg == "--min-scale" && hasValue)
+        {
+            options.MinScale = std::max(1.0 / 1024.0, std::strtod(argv[++index], nullptr));
+        }
+        else if (arg == "--max-scale" && hasValue)
+        {
+            options.MaxScale = std::max(1.0, std::strtod(argv[++index], nullptr));
+        }
+        else if (arg == "--budget" && hasValue)
+        {
+            options.BudgetMs = std::strtoull(argv[++index], nullptr, 10);
+        }
+        else if (arg == "--baseline" && hasValue)
+        {
+            options.Baseline = argv[++index];
+        }
+        else if (arg == "--write-baseline" && hasValue)
+        {
+            options.WriteBaseline = argv[++index];
+        }
+        else if (arg == "--exponent-tolerance" && hasValue)
+        {
+            options.Tolerance.Exponent = std::strtod(argv[++index], nullptr);
+        }
+        else if (arg == "--time-tolerance" && hasValue)
+        {
+            options.Tolerance.Time = std::strtod(argv[++index], nullptr);
+        }
+        else if (arg == "--reference" && hasValue)
+        {
+            options.Reference = argv[++index];
+        }
+        else if (arg == "--threads" && hasValue)
+        {
+            options.Threads = std::strtoull(argv[++index], nullptr, 10);
+        }
+        else if (arg == "--thread-scaling")
+        {
+            options.ThreadScaling = true;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+uint64_t GetMedian(std::vector<uint64_t>& values)
+{
+    std::nth_element(values.begin(), values.begin() + (values.size() - 1) / 2, values.end());
+    return values.at((values.size() - 1) / 2);
+}
+
+PhaseStats ComputeStats(std::string const& name, std::vector<uint64_t> samples, AllocationStats const& allocations, std::vector<PerfSample> const& counters)
+{
+    PhaseStats stats;
+    stats.Name = name;
+    stats.Allocations = allocations;
+    if (samples.empty()) return stats;
+
+    for (size_t event = 0; event < PerfEvent_Count; event++)
+    {
+        std::vector<uint64_t> values;
+        for (PerfSample const& sample : counters)
+        {
+            if (sample.Available[event]) values.push_back(sample.Values[event]);
+        }
+
+        // Only trust events counted on every iteration
+        if (values.size() != counters.size()) continue;
+        stats.Counters.Values[event] = GetMedian(values);
+        stats.Counters.Available[event] = true;
+    }
+
+    std::sort(samples.begin(), samples.end());
+    // Nearest-rank percentiles
+    size_t p99Rank = (samples.size() * 99 + 99) / 100;
+
+    stats.MinNs = samples.front();
+    stats.MedianNs = samples.at((samples.size() - 1) / 2);
+    stats.P99Ns = samples.at(std::max<size_t>(p99Rank, 1) - 1);
+    return stats;
+}
+
+// cachePath is the parse cache of the input, only used with --cache
+void MeasureDay(Options const& options, PerfCounters const& perf, DayInfo const& info, std::string_view input, DayResult& result, std::string const& cachePath = {})
+{
+    using Clock = std::chrono::steady_clock;
+
+    // Phase 0 is Parse, then Part1 and Part2
+    constexpr size_t K_PHASE_COUNT = 3;
+    char const* const K_PHASE_NAMES[K_PHASE_COUNT] = { "parse", "part1", "part2" };
+
+    std::vector<uint64_t> samples[K_PHASE_COUNT];
+    std::vector<PerfSample> counters[K_PHASE_COUNT];
+    AllocationStats allocations[K_PHASE_COUNT];
+    std::optional<std::string> answers[K_PHASE_COUNT];
+
+    for (size_t iteration = 0; iteration < options.Warmup + options.Iterations; iteration++)
+    {
+        std::unique_ptr<Day> day = info.Create();
+        bool measured = iteration >= options.Warmup;
+
+        // Counters are read outside of the timed region, so the syscalls don't show up in the timings
+        auto measure = [&](size_t phase, auto&& function)
+        {
+            PerfSample perfBegin = perf.Read();
+            AllocationScope allocationScope;
+            Clock::time_point begin = Clock::now();
+            function();
+            Clock::time_point end = Clock::now();
+            AllocationStats phaseAllocations = allocationScope.GetStats();
+            PerfSample perfEnd = perf.Read();
+
+            if (!measured) return;
+            samples[phase].push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count());
+            counters[phase].push_back(perfEnd - perfBegin);
+            // Days are deterministic, every iteration allocates the same way
+            allocations[phase] = phaseAllocations;
+        };
+
+        // The first warmup run writes the snapshot when it is missing or stale
+        bool cached = options.ParseCache && !cachePath.empty();
+        measure(0, [&]() { if (cached) ParseCached(day, info, input, cachePath); else day->Parse(input); });
+        measure(1, [&]() { answers[1] = day->Part1(); });
+        measure(2, [&]() { answers[2] = day->Part2(); });
+    }
+
+    result.Name = info.Name;
+    result.InputBytes = input.size();
+    result.Iterations = options.Iterations;
+    for (size_t phase = 0; phase < K_PHASE_COUNT; phase++)
+    {
+        // Skip parts that aren't implemented
+        if (phase > 0 && !answers[phase].has_value()) continue;
+
+        PhaseStats& stats = result.Phases.emplace_back(ComputeStats(K_PHASE_NAMES[phase], samples[phase], allocations[phase], counters[phase]));
+        stats.Answer = answers[phase].value_or(std::string());
+    }
+}
+
+bool RunBenchmark(Options const& options, PerfCounters const& perf, DayInfo const& info, DayResult& result)
+{
+    std::string filename = GetDayInputPath(options.Root, info);
+    InputFile file(filename);
+    if (!file.IsOpen())
+    {
+        std::cerr << "Unable to open " << filename << "\n";
+        return false;
+    }
+
+    MeasureDay(options, perf, info, file.GetData(), result, GetParseCachePath(filename, info));
+    return true;
+}
+
+// Times every phase on generated inputs of doubling size and fits them to a power law
+int RunScaling(Options const& options, PerfCounters const& perf)
+{
+    constexpr uint64_t K_SEED = 1;
+
+    // Generated inputs start small and stop growing past the budget, so the slow days are fitted too
+    std::vector<ScalingResult> results;
+    for (DayInfo const* day : DayRegistry::Get().Select(options.Days, true))
+    {
+        GeneratorInfo const* generator = FindGenerator(day->Name);
+        if (day->IsPlaceholder() || generator == nullptr)
+        {
+            std::cerr << "Skipping " << day->Name << ", no input generator\n";
+            continue;
+        }
+
+        std::cerr << "Scaling " << day->Name << "...\n";
+        size_t first = results.size();
+        double maxScale = generator->MaxScale > 0.0 ? std::min(options.MaxScale, generator->MaxScale) : options.MaxScale;
+        for (double scale = options.MinScale; scale <= maxScale; scale *= 2.0)
+        {
+            std::string input = GenerateInput(*generator, scale, K_SEED);
+            DayResult dayResult;
+            MeasureDay(options, perf, *day, input, dayResult);
+
+            for (PhaseStats const& stats : dayResult.Phases)
+            {
+                auto it = std::find_if(results.begin() + first, results.end(), [&stats](ScalingResult const& result) { return result.Phase == stats.Name; });
+                ScalingResult& result = it != results.end() ? *it : results.emplace_back(ScalingResult{ day->Name, stats.Name, {}, {} });
+                result.Samples.push_back({ scale, stats.MedianNs });
+            }
+
+            if (dayResult.GetTotalMedianNs() > options.BudgetMs * 1000000) break;
+        }
+
+        for (size_t index = first; index < results.size(); index++)
+        {
+            results[index].Fit = FitPowerLaw(results[index].Samples);
+        }
+    }
+
+    ScalingBaseline baseline;
+    if (!options.Baseline.empty() && !LoadScalingBaseline(options.Baseline, baseline))
+    {
+        std::cerr << "Unable to read " << options.Baseline << "\n";
+        return 1;
+    }
+
+    size_t regressions = WriteScalingReport(std::cout, results, baseline, options.Tolerance);
+
+    if (!options.WriteBaseline.empty() && !SaveScalingBaseline(options.WriteBaseline, results))
+    {
+        std::cerr << "Unable to write " << options.WriteBaseline << "\n";
+        return 1;
+    }
+
+    if (regressions > 0)
+    {
+        std::cerr << regressions << " phase(s) regressed\n";
+        return 1;
+    }
+
+    return 0;
+}
+
+// Times every day on its real input with a growing thread pool, answers must not depend on the thread count
+int RunThreadScaling(Options const& options, PerfCounters const& perf)
+{
+    size_t maxThreads = options.Threads > 0 ? options.Threads : std::max<size_t>(1, std::thread::hardware_concurrency());
+
+    std::vector<size_t> threadCounts;
+    for (size_t threads = 1; threads < maxThreads; threads *= 2) threadCounts.push_back(threads);
+    threadCounts.push_back(maxThreads);
+
+    std::cout << std::left << std::setw(8) << "Day" << std::right << std::setw(10) << "Threads" << std::setw(14) << "Total (ms)" << std::setw(10) << "Speedup" << "\n";
+
+    size_t mismatches = 0;
+    for (DayInfo const* day : DayRegistry::Get().Select(options.Days, options.All))
+    {
+        if (day->IsPlaceholder()) continue;
+
+        std::string filename = GetDayInputPath(options.Root, *day);
+        InputFile file(filename);
+        if (!file.IsOpen())
+        {
+            std::cerr << "Unable to open " << filename << "\n";
+            continue;
+        }
+
+        std::cerr << "Thread scaling " << day->Name << "...\n";
+        DayResult reference;
+        for (size_t threads : threadCounts)
+        {
+            ThreadPool::Get().SetThreadCount(threads);
+            DayResult result;
+            MeasureDay(options, perf, *day, file.GetData(), result);
+
+            if (threads == threadCounts.front())
+            {
+                reference = result;
+            }
+            else
+            {
+                for (size_t phase = 0; phase < result.Phases.size() && phase < reference.Phases.size(); phase++)
+                {
+                    if (result.Phases[phase].Answer == reference.Phases[phase].Answer) continue;
+                    std::cerr << day->Name << " " << result.Phases[phase].Name << " answers " << result.Phases[phase].Answer
+                              << " with " << threads << " threads, " << reference.Phases[phase].Answer << " with " << threadCounts.front() << "\n";
+                    mismatches++;
+                }
+            }
+
+            uint64_t totalNs = result.GetTotalMedianNs();
+            double speedup = totalNs > 0 ? static_cast<double>(reference.GetTotalMedianNs()) / totalNs : 0.0;
+            std::cout << std::left << std::setw(8) << day->Name << std::right << std::setw(10) << threads
+                      << std::setw(14) << std::fixed << std::setprecision(3) << totalNs * 1e-6
+                      << std::setw(9) << std::setprecision(2) << speedup << "x\n";
+        }
+    }
+
+    ThreadPool::Get().SetThreadCount(options.Threads);
+    return mismatches > 0 ? 1 : 0;
+}
+
+std::string EscapeJson(std::string const& string)
+{
+    std::string result;
+    for (char c : string)
+    {
+        if (c == '"' || c == '\\') result += '\\';
+        result += c;
+    }
+    return result;
+}
+
+void WriteJson(std::ostream& stream, std::vector<DayResult> const& results)
+{
+    stream << "{\n  \"results\": [\n";
+    for (size_t index = 0; index < results.size(); index++)
+    {
+        DayResult const& result = results.at(index);
+        stream << "    {\n"
+               << "      \"day\": \"" << result.Name << "\",\n"
+               << "      \"input_bytes\": " << result.InputBytes << ",\n"
+               << "      \"iterations\": " << result.Iterations << ",\n"
+               << "      \"phases\": {\n";
+        for (size_t phase = 0; phase < result.Phases.size(); phase++)
+        {
+            PhaseStats const& stats = result.Phases.at(phase);
+            stream << "        \"" << stats.Name << "\": { \"min_ns\": " << stats.MinNs
+                   << ", \"median_ns\": " << stats.MedianNs
+                   << ", \"p99_ns\": " << stats.P99Ns
+                   << ", \"allocations\": " << stats.Allocations.Counters.Count
+                   << ", \"allocated_bytes\": " << stats.Allocations.Counters.Bytes
+                   << ", \"peak_heap_bytes\": " << stats.Allocations.PeakBytes
+                   << ", \"mb_s\": " << result.GetThroughput(stats.MedianNs);
+            for (size_t event = 0; event < PerfEvent_Count; event++)
+            {
+                if (!stats.Counters.Available[event]) continue;
+                stream << ", \"" << GetPerfEventName(static_cast<PerfEvent>(event)) << "\": " << stats.Counters.Values[event];
+            }
+            if (stats.Counters.GetIpc() > 0.0) stream << ", \"ipc\": " << stats.Counters.GetIpc();
+            stream << ", \"answer\": \"" << EscapeJson(stats.Answer) << "\" }"
+                   << (phase + 1 < result.Phases.size() ? "," : "") << "\n";
+        }
+        stream << "      },\n"
+               << "      \"total_mb_s\": " << result.GetThroughput(result.GetTotalMedianNs()) << "\n"
+               << "    }" << (index + 1 < results.size() ? "," : "") << "\n";
+    }
+    stream << "  ]\n}\n";
+}
+
+void WriteCsv(std::ostream& stream, std::vector<DayResult> const& results)
+{
+    stream << "day,phase,input_bytes,iterations,min_ns,median_ns,p99_ns,allocations,allocated_bytes,peak_heap_bytes,mb_s";
+    for (size_t event = 0; event < PerfEvent_Count; event++) stream << ',' << GetPerfEventName(static_cast<PerfEvent>(event));
+    stream << ",ipc,answer\n";
+    for (DayResult const& result : results)
+    {
+        for (size_t phase = 0; phase < result.Phases.size(); phase++)
+        {
+            PhaseStats const& stats = result.Phases.at(phase);
+            stream << result.Name << ',' << stats.Name << ',' << result.InputBytes << ',' << result.Iterations << ','
+                   << stats.MinNs << ',' << stats.MedianNs << ',' << stats.P99Ns << ','
+                   << stats.Allocations.Counters.Count << ',' << stats.Allocations.Counters.Bytes << ',' << stats.Allocations.PeakBytes << ','
+                   << result.GetThroughput(stats.MedianNs) << ',';
+            // Unavailable counters are left empty
+            for (size_t event = 0; event < PerfEvent_Count; event++)
+            {
+                if (stats.Counters.Available[event]) stream << stats.Counters.Values[event];
+                stream << ',';
+            }
+            if (stats.Counters.GetIpc() > 0.0) stream << stats.Counters.GetIpc();
+            stream << ',' << stats.Answer << '\n';
+        }
+    }
+}
+
+void WriteText(std::ostream& stream, std::vector<DayResult> const& results)
+{
+    auto ms = [](uint64_t ns) { return ns * 1e-6; };
+
+    // Hardware counter columns are only shown when the machine exposes them
+    bool hasCounters = std::any_of(results.begin(), results.end(), [](DayResult const& result)
+    {
+        return std::any_of(result.Phases.begin(), result.Phases.end(), [](PhaseStats const& stats) { return stats.Counters.HasAny(); });
+    });
+    auto writeCounter = [&stream](PerfSample const& counters, PerfEvent event)
+    {
+        if (counters.Has(event)) stream << std::setw(14) << counters.Values[event];
+        else stream << std::setw(14) << "-";
+    };
+
+    stream << std::left << std::setw(7) << "Day" << std::setw(7) << "Phase" << std::right
+           << std::setw(12) << "Min" << std::setw(12) << "Median" << std::setw(12) << "P99"
+           << std::setw(10) << "Allocs" << std::setw(14) << "Bytes" << std::setw(14) << "Peak" << std::setw(11) << "MB/s";
+    if (hasCounters)
+    {
+        stream << std::setw(14) << "Cycles" << std::setw(6) << "IPC" << std::setw(14) << "L1D miss" << std::setw(14) << "LLC miss" << std::setw(14) << "Branch miss";
+    }
+    stream << "  Answer\n";
+
+    stream << std::fixed << std::setprecision(3);
+    for (DayResult const& result : results)
+    {
+        for (size_t phase = 0; phase < result.Phases.size(); phase++)
+        {
+            PhaseStats const& stats = result.Phases.at(phase);
+            stream << std::left << std::setw(7) << (phase == 0 ? result.Name : "") << std::setw(7) << stats.Name << std::right
+                   << std::setw(10) << ms(stats.MinNs) << "ms" << std::setw(10) << ms(stats.MedianNs) << "ms"
+                   << std::setw(10) << ms(stats.P99Ns) << "ms" << std::setw(10) << stats.Allocations.Counters.Count
+                   << std::setw(14) << stats.Allocations.Counters.Bytes << std::setw(14) << stats.Allocations.PeakBytes << std::setw(11) << result.GetThroughput(stats.MedianNs);
+            if (hasCounters)
+            {
+                writeCounter(stats.Counters, PerfEvent_Cycles);
+                stream << std::setw(6) << std::setprecision(2) << stats.Counters.GetIpc() << std::setprecision(3);
+                writeCounter(stats.Counters, PerfEvent_L1Misses);
+                writeCounter(stats.Counters, PerfEvent_LlcMisses);
+                writeCounter(stats.Counters, PerfEvent_BranchMisses);
+            }
+            stream << "  " << stats.Answer << "\n";
+        }
+    }
+}
+
+// Sum of every phase's median per day, from a report written with --format csv
+bool LoadReferenceTotals(std::string const& filename, std::map<std::string, uint64_t>& totals)
+{
+    std::ifstream stream(filename);
+    if (!stream) return false;
+
+    std::string line;
+    std::getline(stream, line); // Header
+    while (std::getline(stream, line))
+    {
+        // day,phase,input_bytes,iterations,min_ns,median_ns,...
+        Tokenizer columns(line, ',');
+        std::string_view day, column;
+        if (!columns.Next(day)) continue;
+        for (size_t index = 1; index <= 5 && columns.Next(column); index++) {}
+        totals[std::string(day)] += ParseInteger<uint64_t>(column);
+    }
+
+    return true;
+}
+
+void WriteSpeedups(std::ostream& stream, std::vector<DayResult> const& results, std::map<std::string, uint64_t> const& reference)
+{
+    stream << std::left << std::setw(7) << "Day" << std::right << std::setw(16) << "Reference (ms)" << std::setw(14) << "Median (ms)" << std::setw(10) << "Speedup" << "\n";
+    stream << std::fixed;
+    for (DayResult const& result : results)
+    {
+        auto it = reference.find(result.Name);
+        if (it == reference.end()) continue;
+
+        uint64_t totalNs = result.GetTotalMedianNs();
+        stream << std::left << std::setw(7) << result.Name << std::right << std::setprecision(3)
+               << std::setw(16) << it->second * 1e-6 << std::setw(14) << totalNs * 1e-6
+               << std::setw(9) << std::setprecision(2) << (totalNs > 0 ? static_cast<double>(it->second) / totalNs : 0.0) << "x\n";
+    }
+}
+
+int main(int argc, char** argv)
+{
+    Options options;
+    if (!ParseOptions(argc, argv, options))
+    {
+        PrintUsage();
+        return 1;
+    }
+
+    if (options.GridSize > 0)
+    {
+        RunGridBenchmark(std::cout, options.GridSize, options.Iterations);
+        return 0;
+    }
+
+    if (options.DialMaxCount > 0)
+    {
+        return RunDialBenchmark(std::cout, options.DialMaxCount, options.Iterations) ? 0 : 1;
+    }
+
+    if (options.DialBankLocks > 0)
+    {
+        return RunDialBankBenchmark(std::cout, options.DialBankLocks, options.Iterations) ? 0 : 1;
+    }
+
+    if (options.DialModulusRotations > 0)
+    {
+        return RunDialModulusBenchmark(std::cout, options.DialModulusRotations, options.Iterations) ? 0 : 1;
+    }
+
+    // Only the runtime check of the log is left in the measured phases
+    Log::SetOutput(nullptr);
+
+    PerfCounters perf;
+    if (!perf.GetError().empty())
+    {
+        std::cerr << "Hardware counters : " << perf.GetError() << "\n";
+    }
+
+    if (options.Threads > 0)
+    {
+        ThreadPool::Get().SetThreadCount(options.Threads);
+    }
+
+    if (options.ThreadScaling)
+    {
+        return RunThreadScaling(options, perf);
+    }
+
+    if (options.Scaling)
+    {
+        return RunScaling(options, perf);
+    }
+
+    std::vector<DayResult> results;
+    for (DayInfo const* day : DayRegistry::Get().Select(options.Days, options.All))
+    {
+        if (day->IsPlaceholder())
+        {
+            std::cerr << "Skipping " << day->Name << ", not implemented\n";
+            continue;
+        }
+
+        std::cerr << "Benchmarking " << day->Name << "...\n";
+        DayResult& result = results.emplace_back();
+        if (!RunBenchmark(options, perf, *day, result))
+        {
+            results.pop_back();
+        }
+    }
+
+    std::ofstream outputFile;
+    if (!options.OutputFile.empty())
+    {
+        outputFile.open(options.OutputFile);
+        if (!outputFile)
+        {
+            std::cerr << "Unable to write " << options.OutputFile << "\n";
+            return 1;
+        }
+    }
+    std::ostream& output = options.OutputFile.empty() ? std::cout : outputFile;
+
+    switch (options.OutputFormat)
+    {
+        case Format::Text: WriteText(output, results); break;
+        case Format::Json: WriteJson(output, results); break;
+        case Format::Csv: WriteCsv(output, results); break;
+    }
+
+    if (!options.Reference.empty())
+    {
+        std::map<std::string, uint64_t> reference;
+        if (!LoadReferenceTotals(options.Reference, reference))
+        {
+            std::cerr << "Unable to read " << options.Reference << "\n";
+            return 1;
+        }
+
+        // Under the text report, on stderr next to a csv or json one so it stays parseable
+        std::ostream& speedupOutput = options.OutputFormat == Format::Text ? output : std::cerr;
+        speedupOutput << "\n";
+        WriteSpeedups(speedupOutput, results, reference);
+    }
+
+    return 0;
+}
@@ -0,0 +1,202 @@
+#include "PerfCounters.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <system_error>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+char const* GetPerfEventName(PerfEvent event)
+{
+    switch (event)
+    {
+        case PerfEvent_Cycles: return "cycles";
+        case PerfEvent_Instructions: return "instructions";
+        case PerfEvent_L1Misses: return "l1d_misses";
+        case PerfEvent_LlcMisses: return "llc_misses";
+        case PerfEvent_BranchMisses: return "branch_misses";
+        default: return "unknown";
+    }
+}
+
+bool PerfSample::HasAny() const
+{
+    for (bool available : Available)
+    {
+        if (available) return true;
+    }
+    return false;
+}
+
+double PerfSample::GetIpc() const
+{
+    if (!Has(PerfEvent_Cycles) || !Has(PerfEvent_Instructions) || Values[PerfEvent_Cycles] == 0) return 0.0;
+    return static_cast<double>(Values[PerfEvent_Instructions]) / Values[PerfEvent_Cycles];
+}
+
+PerfSample operator-(PerfSample const& l, PerfSample const& r)
+{
+    PerfSample result;
+    for (size_t event = 0; event < PerfEvent_Count; event++)
+    {
+        result.Available[event] = l.Available[event] && r.Available[event];
+        result.Values[event] = result.Available[event] ? l.Values[event] - r.Values[event] : 0;
+    }
+    return result;
+}
+
+#ifdef __linux__
+
+namespace
+{
+    perf_event_attr GetAttributes(PerfEvent event)
+    {
+        perf_event_attr attributes;
+        std::memset(&attributes, 0, sizeof(attributes));
+        attributes.size = sizeof(attributes);
+        attributes.type = PERF_TYPE_HARDWARE;
+        attributes.exclude_kernel = 1;
+        attributes.exclude_hv = 1;
+        // Counters are multiplexed when the PMU runs short, these let Read scale them back
+        attributes.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+        switch (event)
+        {
+            case PerfEvent_Cycles:
+                attributes.config = PERF_COUNT_HW_CPU_CYCLES;
+                break;
+            case PerfEvent_Instructions:
+                attributes.config = PERF_COUNT_HW_INSTRUCTIONS;
+                break;
+            case PerfEvent_L1Misses:
+                attributes.type = PERF_TYPE_HW_CACHE;
+                attributes.config = PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+                break;
+            case PerfEvent_LlcMisses:
+                attributes.config = PERF_COUNT_HW_CACHE_MISSES;
+                break;
+            case PerfEvent_BranchMisses:
+                attributes.config = PERF_COUNT_HW_BRANCH_MISSES;
+                break;
+            default:
+                break;
+        }
+
+        return attributes;
+    }
+}
+
+PerfCounters::PerfCounters()
+{
+    // The constructing thread first, its errors tell which events the machine exposes
+    ThreadDescriptors& own = m_Threads.emplace_back();
+    own.Thread = static_cast<int>(syscall(SYS_gettid));
+    for (size_t event = 0; event < PerfEvent_Count; event++)
+    {
+        perf_event_attr attributes = GetAttributes(static_cast<PerfEvent>(event));
+        own.Descriptors[event] = static_cast<int>(syscall(SYS_perf_event_open, &attributes, own.Thread, -1, -1, 0));
+        m_Opened[event] = own.Descriptors[event] >= 0;
+
+        if (!m_Opened[event])
+        {
+            if (!m_Error.empty()) m_Error += ", ";
+            m_Error += std::string(GetPerfEventName(static_cast<PerfEvent>(event))) + " (" + std::strerror(errno) + ")";
+        }
+    }
+
+    if (!m_Error.empty()) m_Error = "Unable to open " + m_Error;
+
+    OpenThreads();
+}
+
+PerfCounters::~PerfCounters()
+{
+    for (ThreadDescriptors const& thread : m_Threads)
+    {
+        for (int descriptor : thread.Descriptors)
+        {
+            if (descriptor >= 0) close(descriptor);
+        }
+    }
+}
+
+void PerfCounters::OpenThreads() const
+{
+    if (!IsAvailable()) return;
+
+    std::error_code error;
+    for (std::filesystem::directory_entry const& entry : std::filesystem::directory_iterator("/proc/self/task", error))
+    {
+        int tid = static_cast<int>(std::strtol(entry.path().filename().c_str(), nullptr, 10));
+        bool known = std::any_of(m_Threads.begin(), m_Threads.end(), [tid](ThreadDescriptors const& thread) { return thread.Thread == tid; });
+        if (tid <= 0 || known) continue;
+
+        ThreadDescriptors& thread = m_Threads.emplace_back();
+        thread.Thread = tid;
+        for (size_t event = 0; event < PerfEvent_Count; event++)
+        {
+            perf_event_attr attributes = GetAttributes(static_cast<PerfEvent>(event));
+            thread.Descriptors[event] = m_Opened[event] ? static_cast<int>(syscall(SYS_perf_event_open, &attributes, tid, -1, -1, 0)) : -1;
+        }
+    }
+}
+
+PerfSample PerfCounters::Read() const
+{
+    OpenThreads();
+
+    PerfSample sample;
+    for (ThreadDescriptors const& thread : m_Threads)
+    {
+        for (size_t event = 0; event < PerfEvent_Count; event++)
+        {
+            if (thread.Descriptors[event] < 0) continue;
+
+            // value, time enabled, time running. Counters of threads that exited keep their last value
+            uint64_t data[3];
+            if (read(thread.Descriptors[event], data, sizeof(data)) != sizeof(data) || data[2] == 0) continue;
+
+            sample.Values[event] += data[2] < data[1] ? static_cast<uint64_t>(static_cast<double>(data[0]) * data[1] / data[2]) : data[0];
+            sample.Available[event] = true;
+        }
+    }
+    return sample;
+}
+
+#else
+
+PerfCounters::PerfCounters()
+    : m_Error("Hardware counters are only read on Linux")
+{
+}
+
+PerfCounters::~PerfCounters()
+{
+}
+
+void PerfCounters::OpenThreads() const
+{
+}
+
+PerfSample PerfCounters::Read() const
+{
+    return {};
+}
+
+#endif
+
+bool PerfCounters::IsAvailable() const
+{
+    for (bool opened : m_Opened)
+    {
+        if (opened) return true;
+    }
+    return false;
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+enum PerfEvent : uint32_t
+{
+    PerfEvent_Cycles,
+    PerfEvent_Instructions,
+    PerfEvent_L1Misses,     // L1 data cache read misses
+    PerfEvent_LlcMisses,    // Last level cache misses
+    PerfEvent_BranchMisses,
+    PerfEvent_Count
+};
+
+char const* GetPerfEventName(PerfEvent event);
+
+// Hardware counter values, events the machine doesn't expose are left unavailable
+struct PerfSample
+{
+    uint64_t Values[PerfEvent_Count] = {};
+    bool Available[PerfEvent_Count] = {};
+
+    bool Has(PerfEvent event) const { return Available[event]; }
+    bool HasAny() const;
+
+    // Instructions per cycle, 0 when either is missing
+    double GetIpc() const;
+};
+
+PerfSample operator-(PerfSample const& l, PerfSample const& r);
+
+// Counts the hardware events of every thread of the process (user space only) through perf_event_open, so the work
+// the thread pool's workers do for a day is counted too. Threads started since the last Read are picked up by the
+// next one, counting from then on : threads living and dying between two Reads are missed.
+// Containers and restrictive perf_event_paranoid settings usually forbid it, every event is then unavailable.
+class PerfCounters
+{
+public:
+    PerfCounters();
+    ~PerfCounters();
+
+    PerfCounters(PerfCounters const&) = delete;
+    PerfCounters& operator=(PerfCounters const&) = delete;
+
+    bool IsAvailable() const;
+
+    // Why some events are missing, empty when they all opened
+    std::string const& GetError() const { return m_Error; }
+
+    // Totals of every thread since construction
+    PerfSample Read() const;
+
+private:
+    struct ThreadDescriptors
+    {
+        int Thread;
+        int Descriptors[PerfEvent_Count];
+    };
+
+    // Opens the counters of the threads that don't have theirs yet, errors are only kept for the first one
+    void OpenThreads() const;
+
+    mutable std::vector<ThreadDescriptors> m_Threads;
+    bool m_Opened[PerfEvent_Count] = {}; // Per event, whether the constructing thread's counter opened
+    std::string m_Error;
+};
@@ -0,0 +1,155 @@
+#include "Scaling.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+double PowerLaw::Evaluate(double scale) const
+{
+    return Coefficient * std::pow(scale, Exponent);
+}
+
+double PowerLaw::GetReferenceScale() const
+{
+    return std::min(K_SCALING_REFERENCE_SCALE, MaxScale);
+}
+
+PowerLaw FitPowerLaw(std::vector<ScalingSample> const& samples)
+{
+    double sumX = 0.0, sumY = 0.0, sumXX = 0.0, sumXY = 0.0;
+
+    PowerLaw fit;
+    for (ScalingSample const& sample : samples)
+    {
+        if (sample.MedianNs < K_SCALING_MIN_FIT_NS) continue;
+
+        double x = std::log(sample.Scale);
+        double y = std::log(static_cast<double>(sample.MedianNs));
+        sumX += x;
+        sumY += y;
+        sumXX += x * x;
+        sumXY += x * y;
+        fit.SampleCount++;
+        fit.MaxScale = std::max(fit.MaxScale, sample.Scale);
+    }
+
+    if (!fit.IsValid()) return fit;
+
+    double count = static_cast<double>(fit.SampleCount);
+    double denominator = count * sumXX - sumX * sumX;
+    if (denominator <= 0.0)
+    {
+        fit.SampleCount = 0;
+        return fit;
+    }
+
+    fit.Exponent = (count * sumXY - sumX * sumY) / denominator;
+    fit.Coefficient = std::exp((sumY - fit.Exponent * sumX) / count);
+    return fit;
+}
+
+bool LoadScalingBaseline(std::string const& filename, ScalingBaseline& baseline)
+{
+    std::ifstream stream(filename);
+    if (!stream) return false;
+
+    // "<day> <phase> <exponent> <reference scale> <reference ms>", '#' starts a comment
+    std::string line;
+    while (std::getline(stream, line))
+    {
+        if (line.empty() || line.front() == '#') continue;
+
+        std::istringstream lstream(line);
+        std::string day, phase;
+        ScalingBaselineEntry entry;
+        if (lstream >> day >> phase >> entry.Exponent >> entry.ReferenceScale >> entry.ReferenceMs)
+        {
+            baseline[day + " " + phase] = entry;
+        }
+    }
+
+    return true;
+}
+
+bool SaveScalingBaseline(std::string const& filename, std::vector<ScalingResult> const& results)
+{
+    std::ofstream stream(filename);
+    if (!stream) return false;
+
+    stream << "# aoc_bench --scaling baseline : <day> <phase> <exponent> <scale> <fitted ms at scale>\n";
+    stream << "# The scale is " << K_SCALING_REFERENCE_SCALE << "x, or the largest one measured when lower. Phases too fast to fit are left out\n";
+    stream << std::fixed << std::setprecision(3);
+    for (ScalingResult const& result : results)
+    {
+        if (!result.Fit.IsValid()) continue;
+
+        double scale = result.Fit.GetReferenceScale();
+        stream << result.Day << ' ' << result.Phase << ' ' << result.Fit.Exponent << ' ' << scale << ' ' << result.Fit.Evaluate(scale) * 1e-6 << '\n';
+    }
+
+    return true;
+}
+
+namespace
+{
+    // "64x", "0.250x" : below 1x for the days the budget stops early
+    void WriteScale(std::ostream& stream, double scale, int width)
+    {
+        stream << std::setprecision(scale < 1.0 ? 3 : 0) << std::setw(width - 1) << scale << "x";
+    }
+}
+
+size_t WriteScalingReport(std::ostream& stream, std::vector<ScalingResult> const& results, ScalingBaseline const& baseline, ScalingTolerance const& tolerance)
+{
+    size_t regressions = 0;
+
+    stream << std::left << std::setw(7) << "Day" << std::setw(7) << "Phase" << std::right
+           << std::setw(8) << "Scales" << std::setw(10) << "Exponent" << std::setw(8) << "At" << std::setw(16) << "Time"
+           << std::setw(10) << "Baseline" << std::setw(16) << "Baseline time" << "  Status\n";
+
+    stream << std::fixed;
+    for (ScalingResult const& result : results)
+    {
+        stream << std::left << std::setw(7) << result.Day << std::setw(7) << result.Phase << std::right;
+        WriteScale(stream, result.Samples.empty() ? 0.0 : result.Samples.back().Scale, 8);
+
+        if (!result.Fit.IsValid())
+        {
+            stream << std::setw(10) << "-" << std::setw(8) << "-" << std::setw(16) << "-" << std::setw(10) << "-" << std::setw(16) << "-" << "  too fast to fit\n";
+            continue;
+        }
+
+        // Compared where the baseline was recorded, otherwise never past the largest fitted sample
+        auto it = baseline.find(result.GetKey());
+        double referenceScale = it != baseline.end() ? it->second.ReferenceScale : result.Fit.GetReferenceScale();
+        double referenceMs = result.Fit.Evaluate(referenceScale) * 1e-6;
+        stream << std::setprecision(2) << std::setw(10) << result.Fit.Exponent;
+        WriteScale(stream, referenceScale, 8);
+        stream << std::setprecision(3) << std::setw(14) << referenceMs << "ms";
+
+        if (it == baseline.end())
+        {
+            stream << std::setw(10) << "-" << std::setw(16) << "-" << "  new\n";
+            continue;
+        }
+
+        ScalingBaselineEntry const& entry = it->second;
+        stream << std::setprecision(2) << std::setw(10) << entry.Exponent << std::setprecision(3) << std::setw(14) << entry.ReferenceMs << "ms";
+
+        bool exponentRegressed = result.Fit.Exponent > entry.Exponent + tolerance.Exponent;
+        bool timeRegressed = referenceMs > entry.ReferenceMs * (1.0 + tolerance.Time);
+        if (exponentRegressed || timeRegressed)
+        {
+            regressions++;
+            stream << "  REGRESSION" << (exponentRegressed ? " (exponent)" : "") << (timeRegressed ? " (time)" : "") << "\n";
+        }
+        else
+        {
+            stream << "  ok\n";
+        }
+    }
+
+    return regressions;
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// Samples quicker than this are mostly timer noise and give linear phases superlinear exponents,
+// they are left out of the fits
+constexpr uint64_t K_SCALING_MIN_FIT_NS = 1000000;
+
+// Scale (relative to the real puzzle input) at which the fitted time is compared to the baseline,
+// or the largest fitted scale for the phases that didn't get that far
+constexpr double K_SCALING_REFERENCE_SCALE = 8.0;
+
+struct ScalingSample
+{
+    double Scale = 0.0;
+    uint64_t MedianNs = 0;
+};
+
+// time = Coefficient * scale ^ Exponent, least squares fit in log-log space
+struct PowerLaw
+{
+    double Exponent = 0.0;
+    double Coefficient = 0.0;
+    size_t SampleCount = 0; // Samples slow enough to be part of the fit, at least 3 are needed
+    double MaxScale = 0.0;  // Largest of them, the fit isn't extrapolated past it
+
+    bool IsValid() const { return SampleCount >= 3; }
+    double Evaluate(double scale) const;
+
+    double GetReferenceScale() const;
+};
+
+PowerLaw FitPowerLaw(std::vector<ScalingSample> const& samples);
+
+struct ScalingResult
+{
+    std::string Day;
+    std::string Phase;
+    std::vector<ScalingSample> Samples;
+    PowerLaw Fit;
+
+    std::string GetKey() const { return Day + " " + Phase; }
+};
+
+struct ScalingBaselineEntry
+{
+    double Exponent = 0.0;
+    double ReferenceScale = K_SCALING_REFERENCE_SCALE;
+    double ReferenceMs = 0.0; // Fitted time at ReferenceScale
+};
+
+// "AOC16 part1" -> baseline
+using ScalingBaseline = std::map<std::string, ScalingBaselineEntry>;
+
+bool LoadScalingBaseline(std::string const& filename, ScalingBaseline& baseline);
+bool SaveScalingBaseline(std::string const& filename, std::vector<ScalingResult> const& results);
+
+struct ScalingTolerance
+{
+    double Exponent = 0.3; // Absolute increase of the exponent
+    double Time = 1.0;     // Relative increase of the reference time, 1.0 allows twice as slow
+};
+
+// Prints the fits next to their baseline and returns how many of them regressed beyond the tolerance.
+// Phases missing from the baseline or too fast to be fitted never count as regressions, a fit is compared
+// at the scale its baseline was recorded at.
+size_t WriteScalingReport(std::ostream& stream, std::vector<ScalingResult> const& results, ScalingBaseline const& baseline, ScalingTolerance const& tolerance);
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+
+constexpr size_t K_CACHE_LINE_SIZE = 64;
+
+// Allocates through the aligned operator new, so every block starts on a cache line
+template<typename T, size_t Alignment = K_CACHE_LINE_SIZE>
+struct AlignedAllocator
+{
+    using value_type = T;
+
+    template<typename U>
+    struct rebind
+    {
+        using other = AlignedAllocator<U, Alignment>;
+    };
+
+    AlignedAllocator() = default;
+
+    template<typename U>
+    AlignedAllocator(AlignedAllocator<U, Alignment> const&)
+    {
+    }
+
+    T* allocate(size_t count)
+    {
+        return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t(Alignment)));
+    }
+
+    void deallocate(T* ptr, size_t count)
+    {
+        ::operator delete(ptr, count * sizeof(T), std::align_val_t(Alignment));
+    }
+
+    template<typename U>
+    bool operator==(AlignedAllocator<U, Alignment> const&) const { return true; }
+
+    template<typename U>
+    bool operator!=(AlignedAllocator<U, Alignment> const&) const { return false; }
+};
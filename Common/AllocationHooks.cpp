@@ -0,0 +1,111 @@
+#include "Common/Allocations.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <new>
+
+// Replaces the global operator new/delete so every allocation made by the days is counted.
+// Each block is prefixed by its size, so frees can be accounted for without asking the allocator.
+// Only linked into the runner and the benchmark, the days' own executables keep the standard allocator.
+
+namespace
+{
+    // Keeps the returned pointers aligned as malloc's
+    constexpr size_t K_HEADER_SIZE = alignof(std::max_align_t);
+
+    void* Allocate(size_t size)
+    {
+        // The header would wrap the size around
+        if (size > std::numeric_limits<size_t>::max() - K_HEADER_SIZE) throw std::bad_alloc();
+        CountAllocation(size);
+
+        char* block = static_cast<char*>(std::malloc(K_HEADER_SIZE + size));
+        if (block == nullptr) throw std::bad_alloc();
+
+        *reinterpret_cast<size_t*>(block) = size;
+        return block + K_HEADER_SIZE;
+    }
+
+    void Deallocate(void* ptr)
+    {
+        if (ptr == nullptr) return;
+
+        char* block = static_cast<char*>(ptr) - K_HEADER_SIZE;
+        CountDeallocation(*reinterpret_cast<size_t*>(block));
+        std::free(block);
+    }
+
+    // Over-aligned blocks keep the malloc'ed pointer and the size right before the returned pointer
+    void* AllocateAligned(size_t size, std::align_val_t alignment)
+    {
+        size_t align = std::max(static_cast<size_t>(alignment), alignof(std::max_align_t));
+        if (size > std::numeric_limits<size_t>::max() - align - 2 * sizeof(void*)) throw std::bad_alloc();
+        CountAllocation(size);
+
+        char* block = static_cast<char*>(std::malloc(size + align + 2 * sizeof(void*)));
+        if (block == nullptr) throw std::bad_alloc();
+
+        uintptr_t address = reinterpret_cast<uintptr_t>(block) + 2 * sizeof(void*);
+        char* ptr = reinterpret_cast<char*>((address + align - 1) / align * align);
+        reinterpret_cast<void**>(ptr)[-2] = block;
+        reinterpret_cast<size_t*>(ptr)[-1] = size;
+        return ptr;
+    }
+
+    void DeallocateAligned(void* ptr)
+    {
+        if (ptr == nullptr) return;
+
+        CountDeallocation(static_cast<size_t*>(ptr)[-1]);
+        std::free(static_cast<void**>(ptr)[-2]);
+    }
+}
+
+void* operator new(size_t size) { return Allocate(size); }
+void* operator new[](size_t size) { return Allocate(size); }
+
+void operator delete(void* ptr) noexcept { Deallocate(ptr); }
+void operator delete[](void* ptr) noexcept { Deallocate(ptr); }
+void operator delete(void* ptr, size_t) noexcept { Deallocate(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { Deallocate(ptr); }
+
+void* operator new(size_t size, std::align_val_t alignment) { return AllocateAligned(size, alignment); }
+void* operator new[](size_t size, std::align_val_t alignment) { return AllocateAligned(size, alignment); }
+
+void operator delete(void* ptr, std::align_val_t) noexcept { DeallocateAligned(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept { DeallocateAligned(ptr); }
+void operator delete(void* ptr, size_t, std::align_val_t) noexcept { DeallocateAligned(ptr); }
+void operator delete[](void* ptr, size_t, std::align_val_t) noexcept { DeallocateAligned(ptr); }
+
+// The nothrow forms too, so no block ever reaches a delete it wasn't allocated for (std::stable_sort's buffer, sanitizers)
+void* operator new(size_t size, std::nothrow_t const&) noexcept
+{
+    try { return Allocate(size); }
+    catch (std::bad_alloc const&) { return nullptr; }
+}
+
+void* operator new[](size_t size, std::nothrow_t const&) noexcept
+{
+    try { return Allocate(size); }
+    catch (std::bad_alloc const&) { return nullptr; }
+}
+
+void* operator new(size_t size, std::align_val_t alignment, std::nothrow_t const&) noexcept
+{
+    try { return AllocateAligned(size, alignment); }
+    catch (std::bad_alloc const&) { return nullptr; }
+}
+
+void* operator new[](size_t size, std::align_val_t alignment, std::nothrow_t const&) noexcept
+{
+    try { return AllocateAligned(size, alignment); }
+    catch (std::bad_alloc const&) { return nullptr; }
+}
+
+void operator delete(void* ptr, std::nothrow_t const&) noexcept { Deallocate(ptr); }
+void operator delete[](void* ptr, std::nothrow_t const&) noexcept { Deallocate(ptr); }
+void operator delete(void* ptr, std::align_val_t, std::nothrow_t const&) noexcept { DeallocateAligned(ptr); }
+void operator delete[](void* ptr, std::align_val_t, std::nothrow_t const&) noexcept { DeallocateAligned(ptr); }
@@ -0,0 +1,74 @@
+#include "Common/Allocations.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+// The per-thread totals, fed by the operator new/delete replacement of AllocationHooks.cpp when it is linked
+
+namespace
+{
+    // Trivial so the thread_local never needs a dynamic initialization, which could allocate
+    struct ThreadCounters
+    {
+        AllocationCounters Totals;
+        int64_t LiveBytes;
+        int64_t PeakBytes;
+    };
+
+    thread_local ThreadCounters t_Counters{};
+}
+
+void CountAllocation(size_t size)
+{
+    t_Counters.Totals.Count++;
+    t_Counters.Totals.Bytes += size;
+    t_Counters.LiveBytes += static_cast<int64_t>(size);
+    t_Counters.PeakBytes = std::max(t_Counters.PeakBytes, t_Counters.LiveBytes);
+}
+
+void CountDeallocation(size_t size)
+{
+    t_Counters.Totals.FreeCount++;
+    t_Counters.Totals.FreedBytes += size;
+    t_Counters.LiveBytes -= static_cast<int64_t>(size);
+}
+
+void AddAllocationCounters(AllocationCounters const& counters)
+{
+    t_Counters.Totals = t_Counters.Totals + counters;
+    t_Counters.LiveBytes += static_cast<int64_t>(counters.Bytes) - static_cast<int64_t>(counters.FreedBytes);
+    t_Counters.PeakBytes = std::max(t_Counters.PeakBytes, t_Counters.LiveBytes);
+}
+
+AllocationCounters GetAllocationCounters()
+{
+    return t_Counters.Totals;
+}
+
+int64_t GetLiveAllocatedBytes()
+{
+    return t_Counters.LiveBytes;
+}
+
+AllocationScope::AllocationScope()
+    : m_Begin(t_Counters.Totals)
+    , m_BeginLiveBytes(t_Counters.LiveBytes)
+    , m_PreviousPeak(t_Counters.PeakBytes)
+{
+    t_Counters.PeakBytes = t_Counters.LiveBytes;
+}
+
+AllocationScope::~AllocationScope()
+{
+    // The enclosing scope keeps the highest peak
+    t_Counters.PeakBytes = std::max(m_PreviousPeak, t_Counters.PeakBytes);
+}
+
+AllocationStats AllocationScope::GetStats() const
+{
+    AllocationStats stats;
+    stats.Counters = t_Counters.Totals - m_Begin;
+    stats.PeakBytes = static_cast<uint64_t>(std::max<int64_t>(t_Counters.PeakBytes - m_BeginLiveBytes, 0));
+    return stats;
+}
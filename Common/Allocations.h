@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Heap traffic going through operator new/delete, counted per thread.
+// Only executables linking CommonAllocationHooks (the runner and the benchmark) count anything,
+// everywhere else the standard operator new/delete are kept and the counters stay at 0.
+struct AllocationCounters
+{
+    uint64_t Count = 0;      // Allocations
+    uint64_t Bytes = 0;      // Allocated bytes
+    uint64_t FreeCount = 0;  // Deallocations
+    uint64_t FreedBytes = 0; // Deallocated bytes
+};
+
+// Called by the operator new/delete replacement for every block of the calling thread
+void CountAllocation(size_t size);
+void CountDeallocation(size_t size);
+
+// Totals of the calling thread since it started
+AllocationCounters GetAllocationCounters();
+
+// Bytes allocated and not yet freed by the calling thread, negative when it frees memory allocated elsewhere
+int64_t GetLiveAllocatedBytes();
+
+// Credits the calling thread with the traffic of another one working on its behalf (the thread pool's workers).
+// The other thread's own peak is lost, only its net allocated bytes move the caller's live bytes and peak.
+void AddAllocationCounters(AllocationCounters const& counters);
+
+inline AllocationCounters operator+(AllocationCounters const& l, AllocationCounters const& r)
+{
+    return { l.Count + r.Count, l.Bytes + r.Bytes, l.FreeCount + r.FreeCount, l.FreedBytes + r.FreedBytes };
+}
+
+inline AllocationCounters operator-(AllocationCounters const& l, AllocationCounters const& r)
+{
+    return { l.Count - r.Count, l.Bytes - r.Bytes, l.FreeCount - r.FreeCount, l.FreedBytes - r.FreedBytes };
+}
+
+struct AllocationStats
+{
+    AllocationCounters Counters;
+    uint64_t PeakBytes = 0; // Highest amount of live heap above the start of the scope
+};
+
+// Attributes the heap traffic of the calling thread to a phase, scopes can be nested
+class AllocationScope
+{
+public:
+    AllocationScope();
+    ~AllocationScope();
+
+    AllocationScope(AllocationScope const&) = delete;
+    AllocationScope& operator=(AllocationScope const&) = delete;
+
+    // Traffic since construction
+    AllocationStats GetStats() const;
+
+private:
+    AllocationCounters m_Begin;
+    int64_t m_BeginLiveBytes;
+    int64_t m_PreviousPeak;
+};
@@ -0,0 +1,269 @@
+#include "Common/Day.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+
+#include "Common/InputFile.h"
+#include "Common/Log.h"
+#include "Common/ParseCache.h"
+#include "Common/Profile.h"
+
+DayRegistry& DayRegistry::Get()
+{
+    static DayRegistry registry;
+    return registry;
+}
+
+void DayRegistry::Register(DayInfo info)
+{
+    // "AOC12" -> 12
+    size_t digits = info.Name.find_first_of("0123456789");
+    info.Number = digits != std::string::npos ? std::strtoul(info.Name.c_str() + digits, nullptr, 10) : 0;
+
+    auto it = std::upper_bound(m_Days.begin(), m_Days.end(), info.Number, [](uint32_t number, DayInfo const& day)
+    {
+        return number < day.Number;
+    });
+    m_Days.insert(it, std::move(info));
+}
+
+DayInfo const* DayRegistry::Find(std::string_view name) const
+{
+    std::string normalized = NormalizeDayName(name);
+    auto it = std::find_if(m_Days.begin(), m_Days.end(), [&normalized](DayInfo const& day) { return day.Name == normalized; });
+    return it != m_Days.end() ? &*it : nullptr;
+}
+
+std::vector<DayInfo const*> DayRegistry::Select(std::vector<std::string> const& names, bool includeSlow) const
+{
+    std::vector<DayInfo const*> result;
+
+    if (names.empty())
+    {
+        for (DayInfo const& day : m_Days)
+        {
+            if (includeSlow || !day.IsSlow()) result.push_back(&day);
+        }
+    }
+    else
+    {
+        for (std::string const& name : names)
+        {
+            if (DayInfo const* day = Find(name))
+            {
+                result.push_back(day);
+            }
+            else
+            {
+                std::cerr << "Unknown day " << name << "\n";
+            }
+        }
+    }
+
+    return result;
+}
+
+std::string NormalizeDayName(std::string_view name)
+{
+    bool numeric = !name.empty() && std::all_of(name.begin(), name.end(), [](char c) { return c >= '0' && c <= '9'; });
+    return numeric ? "AOC" + std::string(name) : std::string(name);
+}
+
+std::string GetDayInputPath(std::string const& root, DayInfo const& info)
+{
+    return root + "/" + info.Name + "/input.txt";
+}
+
+namespace
+{
+    // "-" is the standard input
+    constexpr char const* K_STANDARD_INPUT = "-";
+
+    struct BatchTimes
+    {
+        double ParseMs = 0.0;
+        double PartMs[2] = { 0.0, 0.0 };
+        bool Answered[2] = { false, false };
+        size_t Solved = 0;
+        size_t Failed = 0;
+    };
+
+    // Files, directories expanded to the files they hold, and "-", in the given order
+    bool CollectInputs(int argc, char** argv, std::string_view extraUsage, std::vector<std::string>& inputs, bool& useCache)
+    {
+        for (int index = 1; index < argc; index++)
+        {
+            std::string arg = argv[index];
+            if (arg == "--no-cache")
+            {
+                useCache = false;
+                continue;
+            }
+            if (arg != K_STANDARD_INPUT && !arg.empty() && arg.front() == '-')
+            {
+                std::cerr << "Unknown option " << arg << "\n"
+                          << "Usage : " << argv[0] << " [--no-cache] [file|directory|-]...\n";
+                if (!extraUsage.empty()) std::cerr << "        " << argv[0] << " " << extraUsage << "\n";
+                return false;
+            }
+
+            std::error_code error;
+            if (!std::filesystem::is_directory(arg, error))
+            {
+                inputs.push_back(arg);
+                continue;
+            }
+
+            std::vector<std::string> files;
+            for (auto const& entry : std::filesystem::directory_iterator(arg, error))
+            {
+                if (!entry.is_regular_file(error) || entry.path().extension() == ".cache") continue;
+                files.push_back(entry.path().string());
+            }
+            std::sort(files.begin(), files.end());
+            inputs.insert(inputs.end(), files.begin(), files.end());
+        }
+
+        if (inputs.empty()) inputs.push_back("input.txt");
+        return true;
+    }
+
+    bool ReadStandardInput(std::string& buffer)
+    {
+        buffer.clear();
+        char chunk[64 * 1024];
+        size_t size;
+        while ((size = std::fread(chunk, 1, sizeof(chunk), stdin)) > 0)
+        {
+            buffer.append(chunk, size);
+        }
+        return !std::ferror(stdin);
+    }
+
+    double ElapsedMs(std::chrono::steady_clock::time_point begin, std::chrono::steady_clock::time_point end)
+    {
+        return std::chrono::duration<double, std::milli>(end - begin).count();
+    }
+
+    // day is kept from one input to the next, and reset before parsing again
+    bool Solve(DayInfo const& info, std::string const& filename, bool useCache, bool batch, std::string& standardInput, std::unique_ptr<Day>& day, BatchTimes& times)
+    {
+        using Clock = std::chrono::steady_clock;
+
+        // The text of an input lives until its answers are out, Reset drops the day's views into it before the next.
+        // The standard input's buffer is reused from one "-" to the next.
+        InputFile file;
+        std::string_view input;
+        bool fromStandardInput = filename == K_STANDARD_INPUT;
+        if (fromStandardInput)
+        {
+            if (!ReadStandardInput(standardInput))
+            {
+                std::cerr << "Unable to read the standard input\n";
+                return false;
+            }
+            input = standardInput;
+        }
+        else
+        {
+            if (!file.Open(filename))
+            {
+                std::cerr << "Unable to open " << filename << "\n";
+                return false;
+            }
+            input = file.GetData();
+        }
+
+        if (batch) std::cout << filename << "\n";
+
+        if (day == nullptr || !day->Reset()) day = info.Create();
+        Clock::time_point begin = Clock::now();
+        {
+            AOC_PROFILE_SCOPE(info.Name + " Parse");
+            if (useCache && !fromStandardInput) ParseCached(day, info, input, GetParseCachePath(filename, info));
+            else day->Parse(input);
+        }
+        times.ParseMs += ElapsedMs(begin, Clock::now());
+
+        for (size_t part = 0; part < 2; part++)
+        {
+            std::optional<std::string> answer;
+            begin = Clock::now();
+            {
+                AOC_PROFILE_SCOPE(info.Name + (part == 0 ? " Part1" : " Part2"));
+                answer = part == 0 ? day->Part1() : day->Part2();
+            }
+            double elapsedMs = ElapsedMs(begin, Clock::now());
+            times.PartMs[part] += elapsedMs;
+
+            // The log of each part comes before its answer
+            Log::Flush();
+            if (!answer) continue;
+            times.Answered[part] = true;
+
+            std::cout << (batch ? "  " : "") << "Part " << (part + 1) << " : " << *answer;
+            if (batch) std::cout << "  (" << elapsedMs << "ms)";
+            std::cout << "\n";
+        }
+
+        return true;
+    }
+}
+
+int RunDay(std::string_view name, int argc, char** argv, std::string_view extraUsage)
+{
+    DayInfo const* info = DayRegistry::Get().Find(name);
+    if (info == nullptr)
+    {
+        std::cerr << "Unknown day " << name << "\n";
+        return 1;
+    }
+
+    if (info->IsPlaceholder())
+    {
+        std::cout << info->Name << " is not implemented yet\n";
+        return 0;
+    }
+
+    std::vector<std::string> inputs;
+    bool useCache = true;
+    if (!CollectInputs(argc, argv, extraUsage, inputs, useCache)) return 1;
+
+    // A batch would leave a snapshot next to every one of its inputs
+    bool batch = inputs.size() > 1;
+    if (batch) useCache = false;
+    std::cout << std::fixed << std::setprecision(3);
+
+    BatchTimes times;
+    std::string standardInput;
+    std::unique_ptr<Day> day;
+    for (std::string const& filename : inputs)
+    {
+        if (Solve(*info, filename, useCache, batch, standardInput, day, times)) times.Solved++;
+        else times.Failed++;
+    }
+
+    if (batch)
+    {
+        std::cout << "\nInputs : " << times.Solved << " solved, " << times.Failed << " failed\n"
+                  << "Parse : " << times.ParseMs << "ms\n";
+        for (size_t part = 0; part < 2; part++)
+        {
+            if (times.Answered[part]) std::cout << "Part " << (part + 1) << " : " << times.PartMs[part] << "ms\n";
+        }
+        std::cout << "Total : " << times.ParseMs + times.PartMs[0] + times.PartMs[1] << "ms\n";
+    }
+
+    if (Profile::IsCompiled())
+    {
+        std::cout << "\n";
+        Profile::WriteSummary(std::cout);
+    }
+
+    return times.Failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+class CacheReader;
+class CacheWriter;
+
+// Common entry point of every AOC solution.
+// Parse builds the day's structures from the raw input text, Part1 and Part2 compute the answers from them.
+// Keeping the phases apart lets the tools time and drive each of them separately.
+// The input passed to Parse must outlive the Day, solutions are free to keep views into it.
+// Parts must not alter the parsed state, so they can be called several times after a single Parse.
+// A part that isn't implemented returns std::nullopt.
+// Days with a costly parse can also snapshot their parsed state (see ParseCache.h) : GetCacheLayout returns
+// a non zero version of the snapshot's layout, SaveParsed writes it and LoadParsed restores it in place of Parse.
+// Batches parse their inputs one after the other with the same Day : Reset drops the parsed state, views into the
+// previous input included, but keeps the memory of its containers for the next Parse. Days returning false
+// (the default, for the ones building new structures anyway) get a new Day per input instead.
+class Day
+{
+public:
+    virtual ~Day() = default;
+
+    virtual void Parse(std::string_view input) = 0;
+    virtual std::optional<std::string> Part1() { return std::nullopt; }
+    virtual std::optional<std::string> Part2() { return std::nullopt; }
+    virtual bool Reset() { return false; }
+
+    virtual uint32_t GetCacheLayout() const { return 0; }
+    virtual void SaveParsed(CacheWriter&) const {}
+    virtual bool LoadParsed(CacheReader&) { return false; }
+};
+
+enum DayFlags : uint32_t
+{
+    DayFlag_None = 0,
+    DayFlag_Slow = 1 << 0,          // Takes minutes (or more) on the real input, tools skip it unless asked for
+    DayFlag_Placeholder = 1 << 1,   // No solution yet, there is no input to read
+};
+
+struct DayInfo
+{
+    std::string Name;
+    uint32_t Number;
+    uint32_t Flags;
+    std::function<std::unique_ptr<Day>()> Create;
+
+    bool IsSlow() const { return Flags & DayFlag_Slow; }
+    bool IsPlaceholder() const { return Flags & DayFlag_Placeholder; }
+};
+
+// Every Day registers itself here at static initialization time (see AOC_REGISTER_DAY).
+// Executables get the days they link against, nothing else has to be listed by hand.
+class DayRegistry
+{
+public:
+    static DayRegistry& Get();
+
+    void Register(DayInfo info);
+
+    // Days sorted by number
+    std::vector<DayInfo> const& GetDays() const { return m_Days; }
+    DayInfo const* Find(std::string_view name) const;
+
+    // Days matching the given names ("AOC3" or "3"), or every day when empty.
+    // Slow days are only part of the default selection when includeSlow is set.
+    std::vector<DayInfo const*> Select(std::vector<std::string> const& names, bool includeSlow) const;
+
+private:
+    std::vector<DayInfo> m_Days;
+};
+
+struct DayRegistrar
+{
+    DayRegistrar(char const* name, uint32_t flags, std::function<std::unique_ptr<Day>()> create)
+    {
+        DayRegistry::Get().Register(DayInfo{ name, 0, flags, std::move(create) });
+    }
+};
+
+#define AOC_REGISTER_DAY_FLAGS(Name, Type, Flags) \
+    static DayRegistrar s_##Name##Registrar(#Name, Flags, [] { return std::unique_ptr<Day>(std::make_unique<Type>()); })
+
+#define AOC_REGISTER_DAY(Name, Type) AOC_REGISTER_DAY_FLAGS(Name, Type, DayFlag_None)
+
+// "3" -> "AOC3", any other name is left untouched
+std::string NormalizeDayName(std::string_view name);
+
+// Location of a day's puzzle input inside the repository
+std::string GetDayInputPath(std::string const& root, DayInfo const& info);
+
+// Entry point of the per-day executables : parses (through the parse cache) and solves a registered day,
+// then prints its answers. Arguments select the inputs, "input.txt" when there are none :
+//   <file>       An input file
+//   <directory>  Every file in it, by name, parse cache snapshots aside
+//   -            The standard input
+//   --no-cache   Always parse the inputs
+// With several inputs, every answer comes under its input's path, followed by the timings of the whole batch.
+// A batch parses every input from its text, without the parse cache, resetting the same Day between them.
+// extraUsage lists the modes the day's own main handles before calling RunDay, for the usage shown on a bad option.
+int RunDay(std::string_view name, int argc, char** argv, std::string_view extraUsage = {});
@@ -0,0 +1,77 @@
+#include "Common/DialSummary.h"
+
+#include <iomanip>
+#include <iostream>
+
+#include "Common/InputFile.h"
+
+std::array<DialPassword, DialSummary::K_POSITIONS> DialSummary::GetPasswords() const
+{
+    std::array<DialPassword, K_POSITIONS> passwords;
+    for (uint64_t start = 0; start < K_POSITIONS; start++)
+    {
+        passwords[start] = { GetEnd(start), m_Landings[start], m_Crossings[start] };
+    }
+    return passwords;
+}
+
+DialSummary DialSummary::Then(DialSummary const& next) const
+{
+    DialSummary summary;
+    summary.m_Shift = (m_Shift + next.m_Shift) % K_POSITIONS;
+    for (uint64_t start = 0; start < K_POSITIONS; start++)
+    {
+        uint64_t middle = GetEnd(start);
+        summary.m_Landings[start] = m_Landings[start] + next.m_Landings[middle];
+        summary.m_Crossings[start] = m_Crossings[start] + next.m_Crossings[middle];
+    }
+    return summary;
+}
+
+DialSummary DialSummaryBuilder::Build() const
+{
+    DialSummary summary;
+    summary.m_Shift = m_Shift;
+    summary.m_Landings = m_Landings;
+
+    uint64_t crossings = m_FullTurns;
+    for (uint64_t start = 0; start < K_POSITIONS; start++)
+    {
+        crossings += m_CrossingSteps[start];
+        summary.m_Crossings[start] = crossings;
+    }
+    return summary;
+}
+
+void PrintPasswords(std::ostream& stream, DialSummary const& summary)
+{
+    std::array<DialPassword, DialSummary::K_POSITIONS> passwords = summary.GetPasswords();
+
+    stream << std::setw(5) << "Start" << std::setw(5) << "End" << std::setw(16) << "Landings" << std::setw(16) << "Crossings" << "\n";
+    for (uint64_t start = 0; start < DialSummary::K_POSITIONS; start++)
+    {
+        DialPassword const& password = passwords[start];
+        stream << std::setw(5) << start << std::setw(5) << password.End << std::setw(16) << password.Landings << std::setw(16) << password.Crossings << "\n";
+    }
+}
+
+int RunAllStarts(std::string const& inputPath, void (*summarize)(DialSummaryBuilder& builder, std::string_view rotation))
+{
+    InputFile input(inputPath);
+    if (!input.IsOpen())
+    {
+        std::cerr << "Unable to open " << inputPath << "\n";
+        return 1;
+    }
+
+    std::vector<std::string_view> rotations;
+    Tokenizer lines(input.GetData());
+    std::string_view line;
+    while (lines.Next(line))
+    {
+        rotations.push_back(line);
+    }
+
+    PrintPasswords(std::cout, SummarizeRotations(rotations, summarize));
+    return 0;
+}
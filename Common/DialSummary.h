@@ -0,0 +1,152 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Common/ThreadPool.h"
+
+// What a run of rotations does to AOC1/AOC2's 100 positions dial, for every position it may start from :
+// where it ends, how many rotations end on 0 and how many clicks land on 0.
+// Summaries of consecutive runs combine with Then, which is associative, so a long log can be summarized
+// one chunk per thread then folded in order.
+struct DialPassword
+{
+    uint64_t End = 0;
+    uint64_t Landings = 0;  // AOC1's password
+    uint64_t Crossings = 0; // AOC2's password
+};
+
+class DialSummary
+{
+public:
+    static constexpr uint64_t K_POSITIONS = 100;
+
+    uint64_t GetEnd(uint64_t start) const { return (start + m_Shift) % K_POSITIONS; }
+    uint64_t GetLandings(uint64_t start) const { return m_Landings[start]; }
+    uint64_t GetCrossings(uint64_t start) const { return m_Crossings[start]; }
+
+    // Indexed by start position
+    std::array<DialPassword, K_POSITIONS> GetPasswords() const;
+
+    // This summary's rotations followed by next's
+    DialSummary Then(DialSummary const& next) const;
+
+private:
+    friend class DialSummaryBuilder;
+
+    uint64_t m_Shift = 0; // Every start moves by the same amount, the rotations only add up
+    std::array<uint64_t, K_POSITIONS> m_Landings = {};
+    std::array<uint64_t, K_POSITIONS> m_Crossings = {};
+};
+
+// Summarizes rotations in constant time each. A rotation only lands on 0 from one start, and only one
+// partial turn's worth of starts click on 0 on top of the full turns, so the crossings are kept as a
+// difference array over the starts and summed up once in Build.
+class DialSummaryBuilder
+{
+public:
+    // Towards the higher positions, 99 wraps to 0
+    void TurnUp(uint64_t count)
+    {
+        uint64_t partial = count % K_POSITIONS;
+        m_FullTurns += count / K_POSITIONS;
+
+        // The starts currently on [100 - partial, 99] wrap to 0
+        AddCrossings(K_POSITIONS - partial, partial);
+        m_Shift = (m_Shift + partial) % K_POSITIONS;
+        m_Landings[(K_POSITIONS - m_Shift) % K_POSITIONS]++;
+    }
+
+    // Towards the lower positions, 0 wraps to 99
+    void TurnDown(uint64_t count)
+    {
+        uint64_t partial = count % K_POSITIONS;
+        m_FullTurns += count / K_POSITIONS;
+
+        // The starts currently on [1, partial] go down to 0
+        AddCrossings(1, partial);
+        m_Shift = (m_Shift + K_POSITIONS - partial) % K_POSITIONS;
+        m_Landings[(K_POSITIONS - m_Shift) % K_POSITIONS]++;
+    }
+
+    DialSummary Build() const;
+
+private:
+    static constexpr uint64_t K_POSITIONS = DialSummary::K_POSITIONS;
+
+    // One more crossing for the count starts currently on position, position + 1... wrapping around
+    void AddCrossings(uint64_t position, uint64_t count)
+    {
+        if (count == 0) return;
+
+        uint64_t first = (position + K_POSITIONS - m_Shift) % K_POSITIONS;
+        uint64_t last = first + count;
+        m_CrossingSteps[first]++;
+        if (last <= K_POSITIONS)
+        {
+            m_CrossingSteps[last]--;
+        }
+        else
+        {
+            m_CrossingSteps[0]++;
+            m_CrossingSteps[last - K_POSITIONS]--;
+        }
+    }
+
+    uint64_t m_Shift = 0;
+    uint64_t m_FullTurns = 0;
+    std::array<uint64_t, K_POSITIONS> m_Landings = {};
+    std::array<uint64_t, K_POSITIONS + 1> m_CrossingSteps = {}; // Wraps around, only the sums are meaningful
+};
+
+// Reads the next "L45" line of a log, usable at compile time unlike Scanner. Returns false once the log runs out.
+constexpr bool NextRotation(std::string_view& log, char& direction, uint64_t& count)
+{
+    while (!log.empty() && (log.front() == '\n' || log.front() == '\r' || log.front() == ' ')) log.remove_prefix(1);
+    if (log.empty()) return false;
+
+    direction = log.front();
+    log.remove_prefix(1);
+    count = 0;
+    while (!log.empty() && log.front() >= '0' && log.front() <= '9')
+    {
+        count = count * 10 + static_cast<uint64_t>(log.front() - '0');
+        log.remove_prefix(1);
+    }
+    return true;
+}
+
+// Logs longer than this are summarized one chunk per task, the summaries then folded in order
+constexpr size_t K_DIAL_ROTATIONS_PER_CHUNK = 1 << 16;
+
+// summarize(builder, rotation) adds one line of the log to builder
+template<typename Summarize>
+DialSummary SummarizeRotations(std::vector<std::string_view> const& rotations, Summarize&& summarize)
+{
+    size_t chunkCount = (rotations.size() + K_DIAL_ROTATIONS_PER_CHUNK - 1) / K_DIAL_ROTATIONS_PER_CHUNK;
+    return ParallelReduce(0, chunkCount, 1, DialSummary(), [&](size_t chunk)
+    {
+        size_t first = chunk * K_DIAL_ROTATIONS_PER_CHUNK;
+        size_t last = std::min(rotations.size(), first + K_DIAL_ROTATIONS_PER_CHUNK);
+
+        DialSummaryBuilder builder;
+        for (size_t index = first; index < last; index++)
+        {
+            summarize(builder, rotations[index]);
+        }
+        return builder.Build();
+    }, [](DialSummary const& summary, DialSummary const& next) { return summary.Then(next); });
+}
+
+// One line per start position : start, end, landings, crossings
+void PrintPasswords(std::ostream& stream, DialSummary const& summary);
+
+// Entry point of AOC1/AOC2's --all-starts mode : prints the passwords of every start position, from one pass over
+// the rotations in inputPath
+int RunAllStarts(std::string const& inputPath, void (*summarize)(DialSummaryBuilder& builder, std::string_view rotation));
@@ -0,0 +1,200 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "Common/AlignedAllocator.h"
+#include "Common/InputFile.h"
+
+// Non-owning view over evenly spaced cells : a grid row (step 1) or column (step = stride)
+template<typename T>
+class GridSlice
+{
+public:
+    class Iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::remove_const_t<T>;
+        using difference_type = ptrdiff_t;
+        using pointer = T*;
+        using reference = T&;
+
+        Iterator(T* cell, ptrdiff_t step)
+            : m_Cell(cell)
+            , m_Step(step)
+        {
+        }
+
+        T& operator*() const { return *m_Cell; }
+        Iterator& operator++() { m_Cell += m_Step; return *this; }
+        bool operator==(Iterator const& other) const { return m_Cell == other.m_Cell; }
+        bool operator!=(Iterator const& other) const { return m_Cell != other.m_Cell; }
+
+    private:
+        T* m_Cell;
+        ptrdiff_t m_Step;
+    };
+
+    GridSlice(T* first, size_t size, ptrdiff_t step)
+        : m_First(first)
+        , m_Size(size)
+        , m_Step(step)
+    {
+    }
+
+    size_t GetSize() const { return m_Size; }
+    T& operator[](size_t index) const { return m_First[static_cast<ptrdiff_t>(index) * m_Step]; }
+
+    Iterator begin() const { return Iterator(m_First, m_Step); }
+    Iterator end() const { return Iterator(m_First + static_cast<ptrdiff_t>(m_Size) * m_Step, m_Step); }
+
+private:
+    T* m_First;
+    size_t m_Size;
+    ptrdiff_t m_Step;
+};
+
+// Row-major 2D grid surrounded by a border of sentinel cells.
+// Reads up to GetBorder() cells outside of the grid land on the sentinel, so neighbour lookups skip bounds checks.
+// Every row, border included, starts on a cache line when the cell size divides it.
+template<typename T>
+class Grid
+{
+public:
+    Grid() = default;
+
+    Grid(size_t width, size_t height, T const& fill = T(), size_t border = 0, T const& sentinel = T())
+        : m_Width(width)
+        , m_Height(height)
+        , m_Border(border)
+        , m_Stride(ComputeStride(width + 2 * border))
+        , m_Data(m_Stride * (height + 2 * border), sentinel)
+    {
+        for (size_t y = 0; y < height; y++)
+        {
+            std::fill_n(&At(0, static_cast<int64_t>(y)), width, fill);
+        }
+    }
+
+    size_t GetWidth() const { return m_Width; }
+    size_t GetHeight() const { return m_Height; }
+    size_t GetBorder() const { return m_Border; }
+    size_t GetStride() const { return m_Stride; }
+
+    bool Contains(int64_t x, int64_t y) const
+    {
+        return x >= 0 && y >= 0 && static_cast<size_t>(x) < m_Width && static_cast<size_t>(y) < m_Height;
+    }
+
+    // No bounds check : x and y may go up to GetBorder() cells outside of the grid
+    T& At(int64_t x, int64_t y)
+    {
+        return m_Data[GetIndex(x, y)];
+    }
+
+    T const& At(int64_t x, int64_t y) const
+    {
+        return m_Data[GetIndex(x, y)];
+    }
+
+    GridSlice<T> GetRow(size_t y) { return GridSlice<T>(&At(0, static_cast<int64_t>(y)), m_Width, 1); }
+    GridSlice<T const> GetRow(size_t y) const { return GridSlice<T const>(&At(0, static_cast<int64_t>(y)), m_Width, 1); }
+
+    GridSlice<T> GetColumn(size_t x) { return GridSlice<T>(&At(static_cast<int64_t>(x), 0), m_Height, static_cast<ptrdiff_t>(m_Stride)); }
+    GridSlice<T const> GetColumn(size_t x) const { return GridSlice<T const>(&At(static_cast<int64_t>(x), 0), m_Height, static_cast<ptrdiff_t>(m_Stride)); }
+
+    // First cell holding value, in row-major order
+    bool Find(T const& value, int64_t& px, int64_t& py) const
+    {
+        for (size_t y = 0; y < m_Height; y++)
+        {
+            T const* row = &At(0, static_cast<int64_t>(y));
+            T const* cell = std::find(row, row + m_Width, value);
+            if (cell != row + m_Width)
+            {
+                px = cell - row;
+                py = static_cast<int64_t>(y);
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+private:
+    static size_t ComputeStride(size_t cells)
+    {
+        if (sizeof(T) >= K_CACHE_LINE_SIZE || K_CACHE_LINE_SIZE % sizeof(T) != 0) return cells;
+
+        size_t cellsPerLine = K_CACHE_LINE_SIZE / sizeof(T);
+        return (cells + cellsPerLine - 1) / cellsPerLine * cellsPerLine;
+    }
+
+    size_t GetIndex(int64_t x, int64_t y) const
+    {
+        int64_t border = static_cast<int64_t>(m_Border);
+        assert(x >= -border && x < static_cast<int64_t>(m_Width) + border);
+        assert(y >= -border && y < static_cast<int64_t>(m_Height) + border);
+        return static_cast<size_t>(y + border) * m_Stride + static_cast<size_t>(x + border);
+    }
+
+    size_t m_Width = 0;
+    size_t m_Height = 0;
+    size_t m_Border = 0;
+    size_t m_Stride = 0;
+    std::vector<T, AlignedAllocator<T>> m_Data;
+};
+
+// Swaps the axes of a grid without copying it : At(x, y) reads the grid at (y, x)
+template<typename T>
+class TransposedGridView
+{
+public:
+    explicit TransposedGridView(Grid<T> const& grid)
+        : m_Grid(grid)
+    {
+    }
+
+    size_t GetWidth() const { return m_Grid.GetHeight(); }
+    size_t GetHeight() const { return m_Grid.GetWidth(); }
+
+    T const& At(int64_t x, int64_t y) const { return m_Grid.At(y, x); }
+
+    GridSlice<T const> GetRow(size_t y) const { return m_Grid.GetColumn(y); }
+    GridSlice<T const> GetColumn(size_t x) const { return m_Grid.GetRow(x); }
+
+private:
+    Grid<T> const& m_Grid;
+};
+
+// One cell per character, one row per line. Lines shorter than the longest one are padded with the sentinel.
+inline Grid<char> ParseCharGrid(std::string_view input, size_t border = 0, char sentinel = '.')
+{
+    size_t width = 0;
+    size_t height = 0;
+
+    Tokenizer lines(input);
+    std::string_view line;
+    while (lines.Next(line))
+    {
+        width = std::max(width, line.size());
+        height++;
+    }
+
+    Grid<char> grid(width, height, sentinel, border, sentinel);
+
+    lines = Tokenizer(input);
+    for (int64_t y = 0; lines.Next(line); y++)
+    {
+        std::copy(line.begin(), line.end(), &grid.At(0, y));
+    }
+
+    return grid;
+}
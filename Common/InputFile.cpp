@@ -0,0 +1,163 @@
+#include "Common/InputFile.h"
+
+#include <utility>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+InputFile::InputFile(std::string const& filename)
+{
+    Open(filename);
+}
+
+InputFile::~InputFile()
+{
+    Close();
+}
+
+InputFile::InputFile(InputFile&& other) noexcept
+{
+    *this = std::move(other);
+}
+
+InputFile& InputFile::operator=(InputFile&& other) noexcept
+{
+    if (this != &other)
+    {
+        Close();
+        std::swap(m_Data, other.m_Data);
+        std::swap(m_Size, other.m_Size);
+        std::swap(m_Open, other.m_Open);
+#ifdef _WIN32
+        std::swap(m_File, other.m_File);
+        std::swap(m_Mapping, other.m_Mapping);
+#endif
+    }
+
+    return *this;
+}
+
+#ifdef _WIN32
+
+bool InputFile::Open(std::string const& filename)
+{
+    Close();
+
+    HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE) return false;
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size))
+    {
+        CloseHandle(file);
+        return false;
+    }
+
+    m_File = file;
+    m_Size = static_cast<size_t>(size.QuadPart);
+    m_Open = true;
+
+    // Empty files can't be mapped, they simply expose an empty view
+    if (m_Size == 0) return true;
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping == nullptr)
+    {
+        Close();
+        return false;
+    }
+
+    m_Mapping = mapping;
+    m_Data = static_cast<char const*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+    if (m_Data == nullptr)
+    {
+        Close();
+        return false;
+    }
+
+    return true;
+}
+
+void InputFile::Close()
+{
+    if (m_Data) UnmapViewOfFile(m_Data);
+    if (m_Mapping) CloseHandle(m_Mapping);
+    if (m_File) CloseHandle(m_File);
+
+    m_Data = nullptr;
+    m_Mapping = nullptr;
+    m_File = nullptr;
+    m_Size = 0;
+    m_Open = false;
+}
+
+#else
+
+bool InputFile::Open(std::string const& filename)
+{
+    Close();
+
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat info;
+    if (::fstat(fd, &info) != 0)
+    {
+        ::close(fd);
+        return false;
+    }
+
+    m_Size = static_cast<size_t>(info.st_size);
+    m_Open = true;
+
+    // Empty files can't be mapped, they simply expose an empty view
+    if (m_Size > 0)
+    {
+        void* data = ::mmap(nullptr, m_Size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data == MAP_FAILED)
+        {
+            ::close(fd);
+            m_Size = 0;
+            m_Open = false;
+            return false;
+        }
+
+        // Inputs are always consumed front to back
+        ::madvise(data, m_Size, MADV_SEQUENTIAL);
+        m_Data = static_cast<char const*>(data);
+    }
+
+    // The mapping keeps its own reference on the file
+    ::close(fd);
+    return true;
+}
+
+void InputFile::Close()
+{
+    if (m_Data) ::munmap(const_cast<char*>(m_Data), m_Size);
+
+    m_Data = nullptr;
+    m_Size = 0;
+    m_Open = false;
+}
+
+#endif
+
+std::string_view Trim(std::string_view string)
+{
+    constexpr char const* K_WHITESPACES = " \t\r\n";
+
+    size_t begin = string.find_first_not_of(K_WHITESPACES);
+    if (begin == std::string_view::npos) return {};
+
+    size_t end = string.find_last_not_of(K_WHITESPACES);
+    return string.substr(begin, end - begin + 1);
+}
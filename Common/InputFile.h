@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+// Read-only memory mapping of an input file.
+// The whole file is exposed as a single std::string_view, every line or field handed out
+// from it points straight into the mapping : nothing is copied and nothing is allocated.
+// Views stay valid as long as the InputFile is alive.
+class InputFile
+{
+public:
+    InputFile() = default;
+    explicit InputFile(std::string const& filename);
+    ~InputFile();
+
+    InputFile(InputFile&& other) noexcept;
+    InputFile& operator=(InputFile&& other) noexcept;
+
+    InputFile(InputFile const&) = delete;
+    InputFile& operator=(InputFile const&) = delete;
+
+    bool Open(std::string const& filename);
+    void Close();
+
+    bool IsOpen() const { return m_Open; }
+    size_t GetSize() const { return m_Size; }
+    std::string_view GetData() const { return std::string_view(m_Data, m_Size); }
+
+private:
+    char const* m_Data = nullptr;
+    size_t m_Size = 0;
+    bool m_Open = false;
+
+#ifdef _WIN32
+    void* m_File = nullptr;
+    void* m_Mapping = nullptr;
+#endif
+};
+
+// Splits a view on a delimiter, without any allocation.
+// Behaves like std::getline : a trailing delimiter does not produce an extra empty token.
+// When splitting on '\n', a trailing '\r' is stripped so CRLF files read the same.
+class Tokenizer
+{
+public:
+    explicit Tokenizer(std::string_view data, char delimiter = '\n')
+        : m_Data(data)
+        , m_Delimiter(delimiter)
+    {
+    }
+
+    bool Next(std::string_view& token)
+    {
+        if (m_Data.empty()) return false;
+
+        size_t end = m_Data.find(m_Delimiter);
+        if (end == std::string_view::npos)
+        {
+            token = m_Data;
+            m_Data = {};
+        }
+        else
+        {
+            token = m_Data.substr(0, end);
+            m_Data.remove_prefix(end + 1);
+        }
+
+        if (m_Delimiter == '\n' && !token.empty() && token.back() == '\r')
+        {
+            token.remove_suffix(1);
+        }
+
+        return true;
+    }
+
+    std::string_view GetRemaining() const { return m_Data; }
+    bool IsEmpty() const { return m_Data.empty(); }
+
+private:
+    std::string_view m_Data;
+    char m_Delimiter;
+};
+
+// Removes leading and trailing whitespaces (spaces, tabs and line breaks).
+std::string_view Trim(std::string_view string);
@@ -0,0 +1,127 @@
+#include "Common/Log.h"
+
+#include <atomic>
+#include <iostream>
+#include <mutex>
+#include <streambuf>
+#include <string>
+
+namespace
+{
+    constexpr size_t K_FLUSH_SIZE = 64 * 1024;
+
+    std::mutex g_OutputMutex;
+    std::atomic<std::ostream*> g_Output{ &std::cout };
+    std::atomic<LogLevel> g_Level{ LogLevel::Trace };
+
+    // Appends everything written to the stream to a std::string
+    class StringBuffer : public std::streambuf
+    {
+    public:
+        explicit StringBuffer(std::string& target)
+            : m_Target(target)
+        {
+        }
+
+    protected:
+        int overflow(int c) override
+        {
+            if (c != traits_type::eof()) m_Target.push_back(static_cast<char>(c));
+            return c;
+        }
+
+        std::streamsize xsputn(char const* data, std::streamsize count) override
+        {
+            m_Target.append(data, static_cast<size_t>(count));
+            return count;
+        }
+
+    private:
+        std::string& m_Target;
+    };
+
+    struct ThreadBuffer
+    {
+        std::string Data;
+        StringBuffer Buffer{ Data };
+        std::ostream Stream{ &Buffer };
+        std::ostream* Output = nullptr; // Overrides g_Output when set
+
+        ~ThreadBuffer()
+        {
+            Flush();
+        }
+
+        void Flush()
+        {
+            if (Data.empty()) return;
+
+            std::lock_guard<std::mutex> lock(g_OutputMutex);
+            std::ostream* output = Output ? Output : g_Output.load();
+            if (output)
+            {
+                output->write(Data.data(), Data.size());
+                output->flush();
+            }
+            Data.clear();
+        }
+    };
+
+    ThreadBuffer& GetThreadBuffer()
+    {
+        thread_local ThreadBuffer buffer;
+        return buffer;
+    }
+}
+
+namespace Log
+{
+    void SetLevel(LogLevel level)
+    {
+        g_Level = level;
+    }
+
+    void SetOutput(std::ostream* output)
+    {
+        std::lock_guard<std::mutex> lock(g_OutputMutex);
+        g_Output = output;
+    }
+
+    void SetThreadOutput(std::ostream* output)
+    {
+        ThreadBuffer& buffer = GetThreadBuffer();
+        buffer.Flush();
+        buffer.Output = output;
+    }
+
+    std::ostream* GetThreadOutput()
+    {
+        return GetThreadBuffer().Output;
+    }
+
+    bool IsEnabled(LogLevel level)
+    {
+        if (level < g_Level.load(std::memory_order_relaxed)) return false;
+        return GetThreadBuffer().Output || g_Output.load(std::memory_order_relaxed);
+    }
+
+    void Flush()
+    {
+        GetThreadBuffer().Flush();
+    }
+
+    Message::~Message()
+    {
+        ThreadBuffer& buffer = GetThreadBuffer();
+        buffer.Data.push_back('\n');
+        if (buffer.Data.size() >= K_FLUSH_SIZE)
+        {
+            buffer.Flush();
+        }
+    }
+
+    std::ostream& Message::GetStream()
+    {
+        return GetThreadBuffer().Stream;
+    }
+}
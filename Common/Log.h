@@ -0,0 +1,89 @@
+#pragma once
+
+#include <ostream>
+
+#define AOC_LOG_LEVEL_TRACE 0
+#define AOC_LOG_LEVEL_DEBUG 1
+#define AOC_LOG_LEVEL_INFO 2
+#define AOC_LOG_LEVEL_WARNING 3
+#define AOC_LOG_LEVEL_ERROR 4
+#define AOC_LOG_LEVEL_NONE 5
+
+// Set by the build (AOC_LOG_LEVEL cache variable)
+#ifndef AOC_LOG_LEVEL
+#define AOC_LOG_LEVEL AOC_LOG_LEVEL_INFO
+#endif
+
+enum class LogLevel
+{
+    Trace = AOC_LOG_LEVEL_TRACE,     // Once per processed item, hot loops
+    Debug = AOC_LOG_LEVEL_DEBUG,     // Once per phase, intermediate results
+    Info = AOC_LOG_LEVEL_INFO,
+    Warning = AOC_LOG_LEVEL_WARNING,
+    Error = AOC_LOG_LEVEL_ERROR,
+    None = AOC_LOG_LEVEL_NONE,
+};
+
+namespace Log
+{
+    // Messages below this level are removed at compile time, their arguments are never evaluated
+    constexpr LogLevel K_COMPILED_LEVEL = static_cast<LogLevel>(AOC_LOG_LEVEL);
+
+    constexpr bool IsCompiled(LogLevel level)
+    {
+        return level >= K_COMPILED_LEVEL;
+    }
+
+    // Runtime filtering, on top of the compile time one (Trace by default : everything compiled is written)
+    void SetLevel(LogLevel level);
+
+    // Shared destination of the messages, std::cout by default, nullptr drops them
+    void SetOutput(std::ostream* output);
+
+    // Redirects the calling thread's messages, nullptr goes back to the shared destination
+    void SetThreadOutput(std::ostream* output);
+    std::ostream* GetThreadOutput();
+
+    bool IsEnabled(LogLevel level);
+
+    // Messages are batched per thread and written once enough of them piled up, at thread exit or on Flush
+    void Flush();
+
+    // A single line of log, queued on destruction
+    class Message
+    {
+    public:
+        Message() = default;
+        ~Message();
+
+        Message(Message const&) = delete;
+        Message& operator=(Message const&) = delete;
+
+        std::ostream& GetStream();
+
+        template<typename T>
+        Message& operator<<(T const& value)
+        {
+            GetStream() << value;
+            return *this;
+        }
+    };
+}
+
+#define AOC_LOG(level, message)                                 \
+    do                                                          \
+    {                                                           \
+        if constexpr (Log::IsCompiled(level))                   \
+        {                                                       \
+            if (Log::IsEnabled(level))                          \
+            {                                                   \
+                Log::Message() << message;                      \
+            }                                                   \
+        }                                                       \
+    } while (0)
+
+#define AOC_LOG_TRACE(message) AOC_LOG(LogLevel::Trace, message)
+#define AOC_LOG_DEBUG(message) AOC_LOG(LogLevel::Debug, message)
+#define AOC_LOG_INFO(message) AOC_LOG(LogLevel::Info, message)
+#define AOC_LOG_WARNING(message) AOC_LOG(LogLevel::Warning, message)
+#define AOC_LOG_ERROR(message) AOC_LOG(LogLevel::Error, message)
@@ -0,0 +1,120 @@
+#include "Common/ParseCache.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <random>
+
+#include "Common/InputFile.h"
+#include "Common/Log.h"
+
+namespace
+{
+    ParseCacheHeader MakeHeader(DayInfo const& info, uint32_t layout, std::string_view input)
+    {
+        ParseCacheHeader header;
+        header.Layout = layout;
+        std::memcpy(header.Day, info.Name.data(), std::min(info.Name.size(), sizeof(header.Day) - 1));
+        header.InputHash = HashInput(input);
+        header.InputSize = input.size();
+        return header;
+    }
+
+    bool Matches(ParseCacheHeader const& header, ParseCacheHeader const& expected)
+    {
+        return header.Magic == expected.Magic && header.Version == expected.Version && header.Layout == expected.Layout
+            && std::memcmp(header.Day, expected.Day, sizeof(header.Day)) == 0
+            && header.InputHash == expected.InputHash && header.InputSize == expected.InputSize;
+    }
+
+    bool Load(Day& day, std::string const& cachePath, ParseCacheHeader const& expected)
+    {
+        InputFile cache(cachePath);
+        if (!cache.IsOpen() || cache.GetSize() < sizeof(ParseCacheHeader)) return false;
+
+        std::string_view data = cache.GetData();
+        ParseCacheHeader header;
+        std::memcpy(&header, data.data(), sizeof(header));
+        data.remove_prefix(sizeof(header));
+        if (!Matches(header, expected) || header.PayloadSize != data.size()) return false;
+
+        // The whole payload has to be read back, anything left over means it doesn't fit the day's layout
+        CacheReader reader(data);
+        return day.LoadParsed(reader) && reader.IsEmpty();
+    }
+
+    void Save(Day const& day, std::string const& cachePath, ParseCacheHeader header)
+    {
+        CacheWriter writer;
+        day.SaveParsed(writer);
+        header.PayloadSize = writer.GetData().size();
+
+        // Written aside then renamed, so a concurrent run never maps a half written snapshot
+        std::string temporaryPath = cachePath + "." + std::to_string(std::random_device{}()) + ".tmp";
+        {
+            std::ofstream stream(temporaryPath, std::ios::binary | std::ios::trunc);
+            stream.write(reinterpret_cast<char const*>(&header), sizeof(header));
+            stream.write(writer.GetData().data(), writer.GetData().size());
+            if (!stream)
+            {
+                AOC_LOG_WARNING("Unable to write the parse cache " << temporaryPath);
+                std::remove(temporaryPath.c_str());
+                return;
+            }
+        }
+
+        std::remove(cachePath.c_str()); // rename doesn't replace on Windows
+        if (std::rename(temporaryPath.c_str(), cachePath.c_str()) != 0)
+        {
+            AOC_LOG_WARNING("Unable to write the parse cache " << cachePath);
+            std::remove(temporaryPath.c_str());
+        }
+    }
+}
+
+uint64_t HashInput(std::string_view input)
+{
+    constexpr uint64_t K_MULTIPLIER = 0x9E3779B97F4A7C15ull;
+
+    // 8 bytes at a time, then the tail
+    uint64_t hash = input.size() * K_MULTIPLIER;
+    size_t index = 0;
+    for (; index + sizeof(uint64_t) <= input.size(); index += sizeof(uint64_t))
+    {
+        uint64_t word;
+        std::memcpy(&word, input.data() + index, sizeof(word));
+        hash = (hash ^ word) * K_MULTIPLIER;
+        hash ^= hash >> 29;
+    }
+    for (; index < input.size(); index++)
+    {
+        hash = (hash ^ static_cast<uint8_t>(input[index])) * K_MULTIPLIER;
+        hash ^= hash >> 29;
+    }
+
+    return hash;
+}
+
+std::string GetParseCachePath(std::string const& inputPath, DayInfo const& info)
+{
+    return inputPath + "." + info.Name + ".cache";
+}
+
+bool ParseCached(std::unique_ptr<Day>& day, DayInfo const& info, std::string_view input, std::string const& cachePath)
+{
+    uint32_t layout = day->GetCacheLayout();
+    if (layout == 0)
+    {
+        day->Parse(input);
+        return false;
+    }
+
+    ParseCacheHeader header = MakeHeader(info, layout, input);
+    if (Load(*day, cachePath, header)) return true;
+
+    // A load that failed half way may have left anything in the day
+    day = info.Create();
+    day->Parse(input);
+    Save(*day, cachePath, header);
+    return false;
+}
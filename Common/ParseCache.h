@@ -0,0 +1,129 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "Common/Day.h"
+
+// Binary snapshots of a Day's parsed state, stored next to its input : AOC23/input.txt -> AOC23/input.txt.AOC23.cache
+// A snapshot is a ParseCacheHeader followed by the payload the day wrote with SaveParsed.
+// It is only loaded when everything in the header matches : format version, day, the day's layout version,
+// and the size and hash of the input. Anything else (missing, truncated, another input, an older layout) is
+// parsed from the text again and the snapshot rewritten.
+// This is a copying cache : the snapshot file is mapped, but LoadParsed copies every array out of it into the day's
+// own containers and the mapping is released once the load is over. A load saves the parsing, not the copy.
+
+constexpr uint32_t K_PARSE_CACHE_MAGIC = 0x43434F41; // "AOCC"
+constexpr uint32_t K_PARSE_CACHE_VERSION = 1;
+
+struct ParseCacheHeader
+{
+    uint32_t Magic = K_PARSE_CACHE_MAGIC;
+    uint32_t Version = K_PARSE_CACHE_VERSION;
+    uint32_t Layout = 0; // The day's own, bumped whenever its payload changes
+    uint32_t Reserved = 0;
+    char Day[16] = {};
+    uint64_t InputHash = 0;
+    uint64_t InputSize = 0;
+    uint64_t PayloadSize = 0;
+    uint64_t Padding = 0; // The payload starts on a cache line
+};
+static_assert(sizeof(ParseCacheHeader) == 64);
+
+// Appends plain values to a payload. Values are stored as their bytes, the cache only ever goes back to the same build.
+class CacheWriter
+{
+public:
+    template<typename T>
+    void Write(T const& value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "Only plain values can be written as bytes");
+        m_Data.append(reinterpret_cast<char const*>(&value), sizeof(T));
+    }
+
+    // Count, then the elements
+    template<typename T>
+    void WriteArray(std::vector<T> const& values)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "Only plain values can be written as bytes");
+        Write<uint64_t>(values.size());
+        m_Data.append(reinterpret_cast<char const*>(values.data()), values.size() * sizeof(T));
+    }
+
+    void WriteString(std::string_view string)
+    {
+        Write<uint64_t>(string.size());
+        m_Data.append(string);
+    }
+
+    std::string_view GetData() const { return m_Data; }
+
+private:
+    std::string m_Data;
+};
+
+// Reads back what a CacheWriter wrote, every read fails once the payload runs out
+class CacheReader
+{
+public:
+    explicit CacheReader(std::string_view data)
+        : m_Data(data)
+    {
+    }
+
+    bool IsEmpty() const { return m_Data.empty(); }
+
+    template<typename T>
+    bool Read(T& value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "Only plain values can be read as bytes");
+        if (m_Data.size() < sizeof(T)) return false;
+
+        std::memcpy(&value, m_Data.data(), sizeof(T));
+        m_Data.remove_prefix(sizeof(T));
+        return true;
+    }
+
+    template<typename T>
+    bool ReadArray(std::vector<T>& values)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "Only plain values can be read as bytes");
+        uint64_t count;
+        if (!Read(count) || count > m_Data.size() / sizeof(T)) return false;
+
+        values.resize(count);
+        std::memcpy(values.data(), m_Data.data(), count * sizeof(T));
+        m_Data.remove_prefix(count * sizeof(T));
+        return true;
+    }
+
+    // Views into the payload, only valid during LoadParsed : copy what has to outlive it
+    bool ReadString(std::string_view& string)
+    {
+        uint64_t size;
+        if (!Read(size) || size > m_Data.size()) return false;
+
+        string = m_Data.substr(0, size);
+        m_Data.remove_prefix(size);
+        return true;
+    }
+
+private:
+    std::string_view m_Data;
+};
+
+// Quick 64 bits hash telling inputs apart, not a cryptographic one
+uint64_t HashInput(std::string_view input);
+
+std::string GetParseCachePath(std::string const& inputPath, DayInfo const& info);
+
+// Loads the day's snapshot from cachePath when it matches input, otherwise parses input and writes a new snapshot.
+// Days without a cache layout are simply parsed. day is created again when a snapshot turns out to be unusable half way.
+// Returns true when the snapshot was loaded.
+bool ParseCached(std::unique_ptr<Day>& day, DayInfo const& info, std::string_view input, std::string const& cachePath);
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "Common/AlignedAllocator.h"
+#include "Common/InputFile.h"
+#include "Common/SpscRing.h"
+#include "Common/ThreadPool.h"
+
+// Records in flight per solver
+constexpr size_t K_PIPELINE_CAPACITY = 1024;
+
+// One solver per pool thread left once the reader has its own, so the pool's thread count applies to pipelines too
+inline size_t GetPipelineSolverCount()
+{
+    size_t threads = ThreadPool::Get().GetThreadCount();
+    return threads > 1 ? threads - 1 : 1;
+}
+
+// A solver's own accumulator, alone on its cache line so solvers never false share
+template<typename T>
+struct alignas(K_CACHE_LINE_SIZE) SolverSlot
+{
+    T Value{};
+};
+
+// Parses the lines of input on the calling thread and solves the records on solverCount pool threads, while parsing goes on.
+// Every solver drains its own SpscRing : records are dealt round-robin, skipping the solvers that are full,
+// so at most solverCount * capacity parsed records are alive at once whatever the input size.
+//   parse(std::string_view line, Record& record) -> bool : fills record from line, false skips the line
+//   solve(size_t solver, Record& record) : solver is in [0, solverCount), to accumulate into per-solver state
+// Records are solved in no particular order. The solvers are pool workers, so their logs and heap traffic go to the
+// caller like any other Run's. With a single solver, or when the pool can't give a thread to the reader and to every
+// solver (a single thread, another Run going on, a call from within a task), each record is solved on the calling
+// thread right after it is parsed, by solver 0.
+template<typename Record, typename ParseFunction, typename SolveFunction>
+void StreamLines(std::string_view input, ParseFunction&& parse, SolveFunction&& solve, size_t solverCount, size_t capacity = K_PIPELINE_CAPACITY)
+{
+    solverCount = std::max<size_t>(1, solverCount);
+
+    auto streamInline = [&]()
+    {
+        Tokenizer lines(input);
+        std::string_view line;
+        Record record;
+        while (lines.Next(line))
+        {
+            if (parse(line, record)) solve(0, record);
+        }
+    };
+
+    if (solverCount == 1 || ThreadPool::Get().GetThreadCount() <= solverCount)
+    {
+        streamInline();
+        return;
+    }
+
+    std::vector<std::unique_ptr<SpscRing<Record>>> rings;
+    for (size_t solver = 0; solver < solverCount; solver++)
+    {
+        rings.push_back(std::make_unique<SpscRing<Record>>(capacity));
+    }
+
+    std::atomic<bool> done{ false };
+
+    // Task 0 is the reader, tasks 1 to solverCount the solvers
+    auto task = [&](size_t index)
+    {
+        if (index > 0)
+        {
+            size_t solver = index - 1;
+            SpscRing<Record>& ring = *rings[solver];
+            Record record;
+            while (true)
+            {
+                if (ring.TryPop(record))
+                {
+                    solve(solver, record);
+                    continue;
+                }
+
+                if (done.load(std::memory_order_acquire))
+                {
+                    // Every push happened before done was set, they are all visible by now
+                    while (ring.TryPop(record)) solve(solver, record);
+                    break;
+                }
+
+                std::this_thread::yield();
+            }
+            return;
+        }
+
+        Tokenizer lines(input);
+        std::string_view line;
+        Record record;
+        size_t next = 0;
+        while (lines.Next(line))
+        {
+            if (!parse(line, record)) continue;
+
+            for (size_t attempt = 1; !rings[next]->TryPush(std::move(record)); attempt++)
+            {
+                next = (next + 1) % solverCount;
+                if (attempt % solverCount == 0) std::this_thread::yield(); // Every solver is full
+            }
+            next = (next + 1) % solverCount;
+        }
+
+        done.store(true, std::memory_order_release);
+    };
+
+    if (!ThreadPool::Get().RunConcurrently(solverCount + 1, task)) streamInline();
+}
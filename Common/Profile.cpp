@@ -0,0 +1,256 @@
+#include "Common/Profile.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <vector>
+
+namespace
+{
+    enum class EventType
+    {
+        Scope,
+        Counter,
+        Gauge
+    };
+
+    struct Event
+    {
+        EventType Type = EventType::Scope;
+        std::string Name;
+        uint64_t TimeNs = 0;
+        uint64_t DurationNs = 0; // Scopes only
+        int64_t Value = 0;       // Counter delta or gauge value
+        uint32_t ThreadId = 0;
+    };
+
+    struct ThreadData;
+
+    // Events of the threads still running, then of the ones that exited
+    std::mutex g_Mutex;
+    std::vector<ThreadData*> g_Threads;
+    std::vector<Event> g_RetiredEvents;
+    uint32_t g_NextThreadId = 0;
+
+    // Every thread records without locking, its events are only gathered when written
+    struct ThreadData
+    {
+        uint32_t Id;
+        std::vector<Event> Events;
+
+        ThreadData()
+        {
+            std::lock_guard<std::mutex> lock(g_Mutex);
+            Id = g_NextThreadId++;
+            g_Threads.push_back(this);
+        }
+
+        ~ThreadData()
+        {
+            std::lock_guard<std::mutex> lock(g_Mutex);
+            g_Threads.erase(std::find(g_Threads.begin(), g_Threads.end(), this));
+            g_RetiredEvents.insert(g_RetiredEvents.end(), std::make_move_iterator(Events.begin()), std::make_move_iterator(Events.end()));
+        }
+    };
+
+    ThreadData& GetThreadData()
+    {
+        thread_local ThreadData data;
+        return data;
+    }
+
+    void Record(EventType type, std::string name, uint64_t timeNs, uint64_t durationNs, int64_t value)
+    {
+        ThreadData& data = GetThreadData();
+        data.Events.push_back(Event{ type, std::move(name), timeNs, durationNs, value, data.Id });
+    }
+
+    // Every recorded event, in chronological order
+    std::vector<Event> GatherEvents()
+    {
+        std::lock_guard<std::mutex> lock(g_Mutex);
+
+        std::vector<Event> events = g_RetiredEvents;
+        for (ThreadData const* data : g_Threads)
+        {
+            events.insert(events.end(), data->Events.begin(), data->Events.end());
+        }
+
+        std::stable_sort(events.begin(), events.end(), [](Event const& l, Event const& r) { return l.TimeNs < r.TimeNs; });
+        return events;
+    }
+
+    std::string EscapeJson(std::string const& string)
+    {
+        std::string result;
+        for (char c : string)
+        {
+            if (c == '"' || c == '\\') result += '\\';
+            result += c;
+        }
+        return result;
+    }
+
+    auto const g_Epoch = std::chrono::steady_clock::now();
+}
+
+namespace Profile
+{
+    uint64_t GetTimeNs()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - g_Epoch).count();
+    }
+
+    void RecordScope(std::string name, uint64_t beginNs, uint64_t endNs)
+    {
+        Record(EventType::Scope, std::move(name), beginNs, endNs - beginNs, 0);
+    }
+
+    void AddCounter(std::string name, int64_t delta)
+    {
+        Record(EventType::Counter, std::move(name), GetTimeNs(), 0, delta);
+    }
+
+    void SetGauge(std::string name, int64_t value)
+    {
+        Record(EventType::Gauge, std::move(name), GetTimeNs(), 0, value);
+    }
+
+    void WriteChromeTrace(std::ostream& stream)
+    {
+        std::vector<Event> events = GatherEvents();
+        std::map<std::string, int64_t> counters;
+
+        // Chrome traces are in microseconds
+        auto us = [](uint64_t ns) { return ns / 1000.0; };
+
+        stream << std::fixed << std::setprecision(3) << "{\"traceEvents\":[\n";
+        for (size_t index = 0; index < events.size(); index++)
+        {
+            Event const& event = events.at(index);
+            stream << "{\"name\":\"" << EscapeJson(event.Name) << "\",\"pid\":0,\"tid\":" << event.ThreadId << ",\"ts\":" << us(event.TimeNs);
+            switch (event.Type)
+            {
+                case EventType::Scope:
+                    stream << ",\"ph\":\"X\",\"dur\":" << us(event.DurationNs) << "}";
+                    break;
+                case EventType::Counter:
+                    stream << ",\"ph\":\"C\",\"args\":{\"value\":" << (counters[event.Name] += event.Value) << "}}";
+                    break;
+                case EventType::Gauge:
+                    stream << ",\"ph\":\"C\",\"args\":{\"value\":" << event.Value << "}}";
+                    break;
+            }
+            stream << (index + 1 < events.size() ? ",\n" : "\n");
+        }
+        stream << "]}\n";
+    }
+
+    void WriteSummary(std::ostream& stream)
+    {
+        struct ScopeStats
+        {
+            uint64_t Calls = 0;
+            uint64_t TotalNs = 0;
+            uint64_t MinNs = std::numeric_limits<uint64_t>::max();
+            uint64_t MaxNs = 0;
+        };
+
+        struct GaugeStats
+        {
+            int64_t Last = 0;
+            int64_t Max = std::numeric_limits<int64_t>::min();
+        };
+
+        std::map<std::string, ScopeStats> scopes;
+        std::map<std::string, int64_t> counters;
+        std::map<std::string, GaugeStats> gauges;
+
+        for (Event const& event : GatherEvents())
+        {
+            switch (event.Type)
+            {
+                case EventType::Scope:
+                {
+                    ScopeStats& stats = scopes[event.Name];
+                    stats.Calls++;
+                    stats.TotalNs += event.DurationNs;
+                    stats.MinNs = std::min(stats.MinNs, event.DurationNs);
+                    stats.MaxNs = std::max(stats.MaxNs, event.DurationNs);
+                    break;
+                }
+                case EventType::Counter:
+                    counters[event.Name] += event.Value;
+                    break;
+                case EventType::Gauge:
+                {
+                    GaugeStats& stats = gauges[event.Name];
+                    stats.Last = event.Value;
+                    stats.Max = std::max(stats.Max, event.Value);
+                    break;
+                }
+            }
+        }
+
+        auto ms = [](uint64_t ns) { return ns * 1e-6; };
+        size_t width = 24;
+        for (auto const& [name, stats] : scopes) width = std::max(width, name.size() + 2);
+        for (auto const& [name, total] : counters) width = std::max(width, name.size() + 2);
+        for (auto const& [name, stats] : gauges) width = std::max(width, name.size() + 2);
+
+        stream << std::fixed << std::setprecision(3);
+        if (!scopes.empty())
+        {
+            // Costliest scopes first
+            std::vector<std::pair<std::string, ScopeStats>> sorted(scopes.begin(), scopes.end());
+            std::stable_sort(sorted.begin(), sorted.end(), [](auto const& l, auto const& r) { return l.second.TotalNs > r.second.TotalNs; });
+
+            stream << std::left << std::setw(width) << "Scope" << std::right << std::setw(8) << "Calls"
+                   << std::setw(14) << "Total" << std::setw(14) << "Mean" << std::setw(14) << "Min" << std::setw(14) << "Max" << "\n";
+            for (auto const& [name, stats] : sorted)
+            {
+                stream << std::left << std::setw(width) << name << std::right << std::setw(8) << stats.Calls
+                       << std::setw(12) << ms(stats.TotalNs) << "ms" << std::setw(12) << ms(stats.TotalNs / stats.Calls) << "ms"
+                       << std::setw(12) << ms(stats.MinNs) << "ms" << std::setw(12) << ms(stats.MaxNs) << "ms\n";
+            }
+        }
+
+        if (!counters.empty())
+        {
+            stream << std::left << std::setw(width) << "Counter" << std::right << std::setw(16) << "Total" << "\n";
+            for (auto const& [name, total] : counters)
+            {
+                stream << std::left << std::setw(width) << name << std::right << std::setw(16) << total << "\n";
+            }
+        }
+
+        if (!gauges.empty())
+        {
+            stream << std::left << std::setw(width) << "Gauge" << std::right << std::setw(16) << "Last" << std::setw(16) << "Max" << "\n";
+            for (auto const& [name, stats] : gauges)
+            {
+                stream << std::left << std::setw(width) << name << std::right << std::setw(16) << stats.Last << std::setw(16) << stats.Max << "\n";
+            }
+        }
+    }
+
+    bool IsEmpty()
+    {
+        std::lock_guard<std::mutex> lock(g_Mutex);
+        if (!g_RetiredEvents.empty()) return false;
+        return std::all_of(g_Threads.begin(), g_Threads.end(), [](ThreadData const* data) { return data->Events.empty(); });
+    }
+
+    void Reset()
+    {
+        std::lock_guard<std::mutex> lock(g_Mutex);
+        g_RetiredEvents.clear();
+        for (ThreadData* data : g_Threads)
+        {
+            data->Events.clear();
+        }
+    }
+}
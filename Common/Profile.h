@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <utility>
+
+// Set by the build (AOC_PROFILE option)
+#ifndef AOC_PROFILE
+#define AOC_PROFILE 0
+#endif
+
+namespace Profile
+{
+    constexpr bool IsCompiled()
+    {
+        return AOC_PROFILE != 0;
+    }
+
+    // Nanoseconds since the start of the process
+    uint64_t GetTimeNs();
+
+    void RecordScope(std::string name, uint64_t beginNs, uint64_t endNs);
+
+    // Counters add up, gauges keep their last value
+    void AddCounter(std::string name, int64_t delta);
+    void SetGauge(std::string name, int64_t value);
+
+    // Only call these once the recording threads are done
+    void WriteChromeTrace(std::ostream& stream);
+    void WriteSummary(std::ostream& stream);
+    bool IsEmpty();
+    void Reset();
+
+    class ScopedTimer
+    {
+    public:
+        explicit ScopedTimer(std::string name)
+            : m_Name(std::move(name))
+            , m_BeginNs(GetTimeNs())
+        {
+        }
+
+        ~ScopedTimer()
+        {
+            RecordScope(std::move(m_Name), m_BeginNs, GetTimeNs());
+        }
+
+        ScopedTimer(ScopedTimer const&) = delete;
+        ScopedTimer& operator=(ScopedTimer const&) = delete;
+
+    private:
+        std::string m_Name;
+        uint64_t m_BeginNs;
+    };
+}
+
+#define AOC_PROFILE_CONCAT_IMPL(a, b) a##b
+#define AOC_PROFILE_CONCAT(a, b) AOC_PROFILE_CONCAT_IMPL(a, b)
+
+// Arguments are not evaluated when profiling is compiled out
+#if AOC_PROFILE
+#define AOC_PROFILE_SCOPE(name) Profile::ScopedTimer AOC_PROFILE_CONCAT(profileScope, __LINE__)(name)
+#define AOC_PROFILE_COUNTER(name, delta) Profile::AddCounter(name, static_cast<int64_t>(delta))
+#define AOC_PROFILE_GAUGE(name, value) Profile::SetGauge(name, static_cast<int64_t>(value))
+#else
+#define AOC_PROFILE_SCOPE(name) do {} while (0)
+#define AOC_PROFILE_COUNTER(name, delta) do {} while (0)
+#define AOC_PROFILE_GAUGE(name, value) do {} while (0)
+#endif
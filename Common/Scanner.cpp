@@ -0,0 +1,74 @@
+#include "Common/Scanner.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define AOC_SCANNER_SSE2 1
+#include <emmintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#else
+#define AOC_SCANNER_SSE2 0
+#endif
+
+namespace
+{
+    bool IsDigit(char c)
+    {
+        return static_cast<unsigned char>(c - '0') < 10;
+    }
+
+#if AOC_SCANNER_SSE2
+    // One bit per byte of the block, set for the decimal digits
+    uint32_t GetDigitMask(char const* data)
+    {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<__m128i const*>(data));
+        __m128i offset = _mm_sub_epi8(block, _mm_set1_epi8('0'));
+        // offset <= 9 as unsigned bytes, there is no unsigned byte compare in SSE2
+        __m128i isDigit = _mm_cmpeq_epi8(_mm_min_epu8(offset, _mm_set1_epi8(9)), offset);
+        return static_cast<uint32_t>(_mm_movemask_epi8(isDigit));
+    }
+
+    size_t CountTrailingZeros(uint32_t value)
+    {
+#ifdef _MSC_VER
+        unsigned long index;
+        _BitScanForward(&index, value);
+        return index;
+#else
+        return static_cast<size_t>(__builtin_ctz(value));
+#endif
+    }
+#endif
+}
+
+size_t CountDigits(std::string_view data)
+{
+    size_t index = 0;
+
+#if AOC_SCANNER_SSE2
+    for (; index + 16 <= data.size(); index += 16)
+    {
+        uint32_t nonDigits = ~GetDigitMask(data.data() + index) & 0xFFFF;
+        if (nonDigits != 0) return index + CountTrailingZeros(nonDigits);
+    }
+#endif
+
+    while (index < data.size() && IsDigit(data[index])) index++;
+    return index;
+}
+
+size_t FindDigit(std::string_view data)
+{
+    size_t index = 0;
+
+#if AOC_SCANNER_SSE2
+    for (; index + 16 <= data.size(); index += 16)
+    {
+        uint32_t digits = GetDigitMask(data.data() + index);
+        if (digits != 0) return index + CountTrailingZeros(digits);
+    }
+#endif
+
+    while (index < data.size() && !IsDigit(data[index])) index++;
+    return index;
+}
@@ -0,0 +1,131 @@
+#pragma once
+
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+
+// Length of the run of decimal digits at the start of data (SSE2 when available)
+size_t CountDigits(std::string_view data);
+
+// Position of the first decimal digit in data, data.size() when there is none (SSE2 when available)
+size_t FindDigit(std::string_view data);
+
+// Reads integers, characters and tokens from a view, without allocating.
+// Unlike std::istream nothing is locale aware : integers go through std::from_chars,
+// or through a digit run found with SIMD when it can't overflow.
+class Scanner
+{
+public:
+    explicit Scanner(std::string_view data)
+        : m_Data(data)
+    {
+    }
+
+    bool IsEmpty() const { return m_Data.empty(); }
+    std::string_view GetRemaining() const { return m_Data; }
+    char Peek() const { return m_Data.empty() ? '\0' : m_Data.front(); }
+
+    // Integer starting right at the current position
+    template<typename T>
+    bool Read(T& value)
+    {
+        static_assert(std::is_integral_v<T>, "Must be Integral");
+
+        if constexpr (std::is_unsigned_v<T>)
+        {
+            // Up to digits10 digits always fit, no need to check for overflows
+            size_t count = CountDigits(m_Data);
+            if (count == 0) return false;
+            if (count <= static_cast<size_t>(std::numeric_limits<T>::digits10))
+            {
+                T result = 0;
+                for (size_t index = 0; index < count; index++)
+                {
+                    result = static_cast<T>(result * 10 + static_cast<T>(m_Data[index] - '0'));
+                }
+
+                value = result;
+                m_Data.remove_prefix(count);
+                return true;
+            }
+        }
+
+        auto [end, error] = std::from_chars(m_Data.data(), m_Data.data() + m_Data.size(), value);
+        if (error != std::errc()) return false;
+
+        m_Data.remove_prefix(static_cast<size_t>(end - m_Data.data()));
+        return true;
+    }
+
+    // Skips whatever separates integers (commas, dashes, spaces, brackets...) then reads the next one.
+    // For signed integers a '-' right before the digits is read as the sign.
+    template<typename T>
+    bool ReadNext(T& value)
+    {
+        size_t start = FindDigit(m_Data);
+        if (start == m_Data.size())
+        {
+            m_Data = {};
+            return false;
+        }
+
+        if constexpr (std::is_signed_v<T>)
+        {
+            if (start > 0 && m_Data[start - 1] == '-') start--;
+        }
+
+        m_Data.remove_prefix(start);
+        return Read(value);
+    }
+
+    bool ReadChar(char& c)
+    {
+        if (m_Data.empty()) return false;
+
+        c = m_Data.front();
+        m_Data.remove_prefix(1);
+        return true;
+    }
+
+    // Consumes c when it comes next
+    bool Skip(char c)
+    {
+        if (m_Data.empty() || m_Data.front() != c) return false;
+
+        m_Data.remove_prefix(1);
+        return true;
+    }
+
+    void SkipSpaces()
+    {
+        size_t count = 0;
+        while (count < m_Data.size() && (m_Data[count] == ' ' || m_Data[count] == '\t')) count++;
+        m_Data.remove_prefix(count);
+    }
+
+    // Everything up to the delimiter, which is consumed. The rest of the data when there's no delimiter.
+    std::string_view ReadUntil(char delimiter)
+    {
+        size_t end = m_Data.find(delimiter);
+        std::string_view token = m_Data.substr(0, end);
+        m_Data.remove_prefix(end == std::string_view::npos ? m_Data.size() : end + 1);
+        return token;
+    }
+
+private:
+    std::string_view m_Data;
+};
+
+// Whole text as a single integer, 0 when it isn't one
+template<typename T>
+T ParseInteger(std::string_view text)
+{
+    T value = 0;
+    Scanner scanner(text);
+    if (!scanner.Read(value) || !scanner.IsEmpty()) return 0;
+    return value;
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "Common/AlignedAllocator.h"
+
+// Bounded lock-free queue between exactly one producer thread and one consumer thread.
+// Each side owns its index and only reads the other one's, with acquire/release ordering.
+// Both keep a cached copy of the other index so the shared cache lines are only touched when the ring
+// looks full (producer) or empty (consumer).
+template<typename T>
+class SpscRing
+{
+public:
+    // Capacity is rounded up to a power of two
+    explicit SpscRing(size_t capacity)
+    {
+        size_t size = 2;
+        while (size < capacity) size *= 2;
+        m_Slots.resize(size);
+        m_Mask = size - 1;
+    }
+
+    SpscRing(SpscRing const&) = delete;
+    SpscRing& operator=(SpscRing const&) = delete;
+
+    size_t GetCapacity() const { return m_Slots.size(); }
+
+    // Producer only, false when the ring is full
+    bool TryPush(T&& value)
+    {
+        size_t tail = m_Tail.load(std::memory_order_relaxed);
+        if (tail - m_CachedHead == m_Slots.size())
+        {
+            m_CachedHead = m_Head.load(std::memory_order_acquire);
+            if (tail - m_CachedHead == m_Slots.size()) return false;
+        }
+
+        m_Slots[tail & m_Mask] = std::move(value);
+        m_Tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer only, false when the ring is empty
+    bool TryPop(T& value)
+    {
+        size_t head = m_Head.load(std::memory_order_relaxed);
+        if (head == m_CachedTail)
+        {
+            m_CachedTail = m_Tail.load(std::memory_order_acquire);
+            if (head == m_CachedTail) return false;
+        }
+
+        value = std::move(m_Slots[head & m_Mask]);
+        m_Head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    std::vector<T, AlignedAllocator<T>> m_Slots;
+    size_t m_Mask = 0;
+
+    // Indices only grow, the slot is the index modulo the capacity
+    alignas(K_CACHE_LINE_SIZE) std::atomic<size_t> m_Head{ 0 }; // Next slot to pop, written by the consumer
+    size_t m_CachedTail = 0;                                      // Consumer's last view of m_Tail
+
+    alignas(K_CACHE_LINE_SIZE) std::atomic<size_t> m_Tail{ 0 }; // Next slot to push, written by the producer
+    size_t m_CachedHead = 0;                                      // Producer's last view of m_Head
+};
@@ -0,0 +1,207 @@
+#include "Common/ThreadPool.h"
+
+#include "Common/Log.h"
+
+namespace
+{
+    // Set on the pool's workers and on a thread running tasks, nested Runs execute inline
+    thread_local bool t_InPool = false;
+}
+
+ThreadPool& ThreadPool::Get()
+{
+    static ThreadPool pool;
+    return pool;
+}
+
+ThreadPool::ThreadPool(size_t threadCount)
+{
+    Start(threadCount);
+}
+
+ThreadPool::~ThreadPool()
+{
+    Stop();
+}
+
+void ThreadPool::SetThreadCount(size_t threadCount)
+{
+    Stop();
+    Start(threadCount);
+}
+
+void ThreadPool::Start(size_t threadCount)
+{
+    if (threadCount == 0) threadCount = std::max<size_t>(1, std::thread::hardware_concurrency());
+
+    m_Stopping = false;
+    for (size_t participant = 0; participant < threadCount; participant++)
+    {
+        m_Queues.push_back(std::make_unique<WorkQueue>());
+    }
+    for (size_t participant = 1; participant < threadCount; participant++)
+    {
+        m_Workers.emplace_back(&ThreadPool::WorkerLoop, this, participant);
+    }
+}
+
+void ThreadPool::Stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Stopping = true;
+    }
+    m_WakeUp.notify_all();
+
+    for (std::thread& worker : m_Workers)
+    {
+        worker.join();
+    }
+    m_Workers.clear();
+    m_Queues.clear();
+}
+
+void ThreadPool::Run(size_t count, std::function<void(size_t)> const& task)
+{
+    if (count == 0) return;
+
+    std::unique_lock<std::mutex> runLock(m_RunMutex, std::try_to_lock);
+    if (t_InPool || !runLock.owns_lock() || m_Workers.empty() || count == 1)
+    {
+        for (size_t index = 0; index < count; index++) task(index);
+        return;
+    }
+
+    Execute(count, task);
+}
+
+bool ThreadPool::RunConcurrently(size_t count, std::function<void(size_t)> const& task)
+{
+    if (count > GetThreadCount() || t_InPool) return false;
+    if (count <= 1)
+    {
+        if (count == 1) task(0);
+        return true;
+    }
+
+    std::unique_lock<std::mutex> runLock(m_RunMutex, std::try_to_lock);
+    if (!runLock.owns_lock()) return false;
+
+    // One task per queue : a thread only steals once its own task is over, so no task waits behind another one
+    Execute(count, task);
+    return true;
+}
+
+void ThreadPool::Execute(size_t count, std::function<void(size_t)> const& task)
+{
+    {
+        // Dealt under the lock : a worker waking up sees either the previous Run's empty queues or this whole Run
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        for (size_t index = 0; index < count; index++)
+        {
+            WorkQueue& queue = *m_Queues[index % m_Queues.size()];
+            std::lock_guard<std::mutex> queueLock(queue.Mutex);
+            queue.Tasks.push_back(index);
+        }
+
+        m_Remaining = count;
+        m_Task = &task;
+        m_LogOutput = Log::GetThreadOutput();
+        m_Generation++;
+    }
+    m_WakeUp.notify_all();
+
+    t_InPool = true;
+    Participate(0, task);
+    t_InPool = false;
+
+    // No worker may still hold the task once Run returns
+    AllocationCounters workerAllocations;
+    {
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_Done.wait(lock, [this]() { return m_Remaining.load() == 0 && m_BusyWorkers == 0; });
+        m_Task = nullptr;
+        workerAllocations = m_WorkerAllocations;
+        m_WorkerAllocations = {};
+    }
+    AddAllocationCounters(workerAllocations);
+}
+
+void ThreadPool::WorkerLoop(size_t participant)
+{
+    t_InPool = true;
+
+    uint64_t generation = 0;
+    while (true)
+    {
+        std::function<void(size_t)> const* task = nullptr;
+        std::ostream* logOutput = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            m_WakeUp.wait(lock, [&]() { return m_Stopping || m_Generation != generation; });
+            if (m_Stopping) return;
+
+            generation = m_Generation;
+            task = m_Task;
+            logOutput = m_LogOutput;
+            if (task == nullptr) continue; // Woke up after the Run was over
+            m_BusyWorkers++;
+        }
+
+        Log::SetThreadOutput(logOutput);
+        AllocationCounters allocationsBegin = GetAllocationCounters();
+        Participate(participant, *task);
+        AllocationCounters allocations = GetAllocationCounters() - allocationsBegin;
+        Log::SetThreadOutput(nullptr); // Flushes to the caller's output before Run returns
+
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_BusyWorkers--;
+            m_WorkerAllocations = m_WorkerAllocations + allocations;
+        }
+        m_Done.notify_all();
+    }
+}
+
+void ThreadPool::Participate(size_t participant, std::function<void(size_t)> const& task)
+{
+    size_t index;
+    while (PopOrSteal(participant, index))
+    {
+        task(index);
+
+        if (m_Remaining.fetch_sub(1) == 1)
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Done.notify_all();
+        }
+    }
+}
+
+bool ThreadPool::PopOrSteal(size_t participant, size_t& index)
+{
+    {
+        WorkQueue& own = *m_Queues[participant];
+        std::lock_guard<std::mutex> lock(own.Mutex);
+        if (!own.Tasks.empty())
+        {
+            index = own.Tasks.front();
+            own.Tasks.pop_front();
+            return true;
+        }
+    }
+
+    for (size_t offset = 1; offset < m_Queues.size(); offset++)
+    {
+        WorkQueue& victim = *m_Queues[(participant + offset) % m_Queues.size()];
+        std::lock_guard<std::mutex> lock(victim.Mutex);
+        if (!victim.Tasks.empty())
+        {
+            index = victim.Tasks.back();
+            victim.Tasks.pop_back();
+            return true;
+        }
+    }
+
+    return false;
+}
@@ -0,0 +1,153 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "Common/AlignedAllocator.h"
+#include "Common/Allocations.h"
+
+// Work-stealing pool shared by every day's parallel loops.
+// Run deals the task indices round-robin to one queue per thread : each thread pops its own queue from the front
+// and steals from the back of the others once it runs dry, so uneven tasks still keep every thread busy.
+// A single Run goes on at a time. Runs from within a task, or while another thread's Run is going on
+// (days running side by side in the runner), execute inline on the calling thread.
+// Workers log to the thread output of the Run's caller while they take part, and their heap traffic is added to
+// the caller's allocation counters once the Run is over.
+class ThreadPool
+{
+public:
+    static ThreadPool& Get();
+
+    // threadCount includes the thread calling Run, 0 is one per hardware thread
+    explicit ThreadPool(size_t threadCount = 0);
+    ~ThreadPool();
+
+    ThreadPool(ThreadPool const&) = delete;
+    ThreadPool& operator=(ThreadPool const&) = delete;
+
+    size_t GetThreadCount() const { return m_Queues.size(); }
+
+    // Restarts the workers, not to be called while a Run is going on
+    void SetThreadCount(size_t threadCount);
+
+    // Calls task(0) ... task(count - 1) and returns once they are all done, the calling thread takes part
+    void Run(size_t count, std::function<void(size_t)> const& task);
+
+    // Same, with every task on its own thread at once, so tasks may wait on each other.
+    // Returns false without calling anything when that can't be promised : more tasks than threads,
+    // another Run going on or a call from within a task.
+    bool RunConcurrently(size_t count, std::function<void(size_t)> const& task);
+
+private:
+    struct alignas(K_CACHE_LINE_SIZE) WorkQueue
+    {
+        std::mutex Mutex;
+        std::deque<size_t> Tasks;
+    };
+
+    void Start(size_t threadCount);
+    void Stop();
+
+    // Deals the tasks round-robin and takes part until they are all done, m_RunMutex held
+    void Execute(size_t count, std::function<void(size_t)> const& task);
+
+    void WorkerLoop(size_t participant);
+    void Participate(size_t participant, std::function<void(size_t)> const& task);
+    bool PopOrSteal(size_t participant, size_t& index);
+
+    std::vector<std::unique_ptr<WorkQueue>> m_Queues; // One per thread, the caller of Run uses the first one
+    std::vector<std::thread> m_Workers;
+
+    std::mutex m_RunMutex;
+
+    // Guards everything below, and the dealing of the tasks
+    std::mutex m_Mutex;
+    std::condition_variable m_WakeUp;
+    std::condition_variable m_Done;
+    std::function<void(size_t)> const* m_Task = nullptr;
+    std::ostream* m_LogOutput = nullptr; // The caller's log output, workers log there while they take part
+    uint64_t m_Generation = 0;
+    size_t m_BusyWorkers = 0;
+    AllocationCounters m_WorkerAllocations; // Heap traffic of the workers during the current Run
+    bool m_Stopping = false;
+
+    std::atomic<size_t> m_Remaining{ 0 };
+};
+
+// Calls function(index) for every index in [begin, end), grain consecutive indices per task
+template<typename Function>
+void ParallelFor(size_t begin, size_t end, size_t grain, Function&& function)
+{
+    if (end <= begin) return;
+
+    grain = std::max<size_t>(1, grain);
+    size_t chunkCount = (end - begin + grain - 1) / grain;
+    ThreadPool::Get().Run(chunkCount, [&](size_t chunk)
+    {
+        size_t first = begin + chunk * grain;
+        size_t last = std::min(end, first + grain);
+        for (size_t index = first; index < last; index++) function(index);
+    });
+}
+
+// Folds map(index) over [begin, end) with combine. The order doesn't depend on the threads :
+// every chunk of grain indices is folded left to right, then the chunks are folded in index order,
+// so even a non associative combine gives the same result whatever the thread count.
+template<typename T, typename Map, typename Combine>
+T ParallelReduce(size_t begin, size_t end, size_t grain, T identity, Map&& map, Combine&& combine)
+{
+    static_assert(!std::is_same_v<T, bool>, "std::vector<bool> can't be written from several threads");
+    if (end <= begin) return identity;
+
+    grain = std::max<size_t>(1, grain);
+    size_t chunkCount = (end - begin + grain - 1) / grain;
+    std::vector<T> partials(chunkCount, identity);
+    ThreadPool::Get().Run(chunkCount, [&](size_t chunk)
+    {
+        size_t first = begin + chunk * grain;
+        size_t last = std::min(end, first + grain);
+        T partial = identity;
+        for (size_t index = first; index < last; index++) partial = combine(partial, map(index));
+        partials[chunk] = partial;
+    });
+
+    T result = identity;
+    for (T const& partial : partials) result = combine(result, partial);
+    return result;
+}
+
+// Smallest index in [begin, end) for which predicate holds, end when there is none.
+// Chunks past the best match found so far are skipped, so little work is done past the answer.
+template<typename Predicate>
+size_t ParallelFindFirst(size_t begin, size_t end, size_t grain, Predicate&& predicate)
+{
+    if (end <= begin) return end;
+
+    grain = std::max<size_t>(1, grain);
+    size_t chunkCount = (end - begin + grain - 1) / grain;
+    std::atomic<size_t> found{ end };
+    ThreadPool::Get().Run(chunkCount, [&](size_t chunk)
+    {
+        size_t first = begin + chunk * grain;
+        size_t last = std::min(end, first + grain);
+        for (size_t index = first; index < last && index < found.load(std::memory_order_relaxed); index++)
+        {
+            if (!predicate(index)) continue;
+
+            size_t best = found.load(std::memory_order_relaxed);
+            while (index < best && !found.compare_exchange_weak(best, index, std::memory_order_relaxed)) {}
+            return;
+        }
+    });
+    return found.load();
+}
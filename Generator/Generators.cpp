@@ -0,0 +1,488 @@
+#include "Generators.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Common/Day.h"
+
+namespace
+{
+    // FNV-1a
+    uint64_t HashFormat(std::string_view format)
+    {
+        uint64_t hash = 0xCBF29CE484222325ull;
+        for (char c : format)
+        {
+            hash ^= static_cast<unsigned char>(c);
+            hash *= 0x100000001B3ull;
+        }
+        return hash;
+    }
+
+    // Size of the real puzzle input times scale, never empty
+    size_t GetScaledCount(size_t count, double scale)
+    {
+        return std::max<size_t>(1, static_cast<size_t>(std::llround(count * scale)));
+    }
+
+    // Grids grow on both axes so that their cell count follows scale
+    size_t GetScaledSide(size_t side, double scale)
+    {
+        return GetScaledCount(side, std::sqrt(scale));
+    }
+
+    template<typename T>
+    void Shuffle(std::vector<T>& values, Random& random)
+    {
+        for (size_t index = values.size(); index > 1; index--)
+        {
+            std::swap(values[index - 1], values[random.Range(0, index - 1)]);
+        }
+    }
+
+    // Number with a uniformly picked count of digits, as the ID ranges spread over every magnitude
+    uint64_t GetNumberWithDigits(size_t digits, Random& random)
+    {
+        uint64_t min = 1;
+        for (size_t index = 1; index < digits; index++) min *= 10;
+        return random.Range(min, min * 10 - 1);
+    }
+
+    // AOC1, AOC2 : "L45" / "R999"
+    void GenerateDialRotations(std::ostream& stream, double scale, Random& random)
+    {
+        size_t count = GetScaledCount(4098, scale);
+        for (size_t index = 0; index < count; index++)
+        {
+            stream << (random.Chance(0.5) ? 'L' : 'R') << random.Range(1, 999) << '\n';
+        }
+    }
+
+    // AOC3, AOC4 : "min-max,min-max,..." on a single line, disjoint ranges in any order
+    void GenerateIdRanges(std::ostream& stream, double scale, Random& random)
+    {
+        size_t count = GetScaledCount(35, scale);
+
+        std::vector<uint64_t> starts;
+        for (size_t index = 0; index < count; index++)
+        {
+            starts.push_back(GetNumberWithDigits(random.Range(1, 10), random));
+        }
+        std::sort(starts.begin(), starts.end());
+
+        std::vector<std::pair<uint64_t, uint64_t>> ranges;
+        uint64_t end = 0;
+        for (uint64_t start : starts)
+        {
+            start = std::max(start, end + 2);
+            end = start + random.Range(0, 200000);
+            ranges.emplace_back(start, end);
+        }
+        Shuffle(ranges, random);
+
+        for (size_t index = 0; index < ranges.size(); index++)
+        {
+            if (index > 0) stream << ',';
+            stream << ranges[index].first << '-' << ranges[index].second;
+        }
+    }
+
+    // AOC5, AOC6 : one bank of 100 batteries per line, joltages 1 to 9
+    void GenerateBatteryBanks(std::ostream& stream, double scale, Random& random)
+    {
+        size_t count = GetScaledCount(200, scale);
+        std::string bank(100, '0');
+        for (size_t index = 0; index < count; index++)
+        {
+            for (char& battery : bank) battery = static_cast<char>('0' + random.Range(1, 9));
+            stream << bank << '\n';
+        }
+    }
+
+    // AOC7, AOC8 : square grid of '@' rolls and '.' floor
+    void GeneratePaperRolls(std::ostream& stream, double scale, Random& random)
+    {
+        size_t side = GetScaledSide(136, scale);
+        std::string row(side, '.');
+        for (size_t y = 0; y < side; y++)
+        {
+            for (char& cell : row) cell = random.Chance(0.67) ? '@' : '.';
+            stream << row << '\n';
+        }
+    }
+
+    // AOC9, AOC10 : overlapping "min-max" spans, a blank line, then one ID per line.
+    // The ID range grows with the span count, so the spans overlap as much as in the real input whatever the scale
+    // and merge into more and more disjoint spans, rather than into a handful covering everything.
+    void GenerateSpanDatabase(std::ostream& stream, double scale, Random& random)
+    {
+        size_t spanCount = GetScaledCount(185, scale);
+        uint64_t maxID = std::max<uint64_t>(1, static_cast<uint64_t>(560000000000000.0 * scale));
+        for (size_t index = 0; index < spanCount; index++)
+        {
+            uint64_t min = random.Range(1, maxID);
+            stream << min << '-' << min + random.Range(0, 5000000000000ull) << '\n';
+        }
+
+        stream << '\n';
+
+        size_t idCount = GetScaledCount(1000, scale);
+        for (size_t index = 0; index < idCount; index++)
+        {
+            stream << random.Range(1, maxID) << '\n';
+        }
+    }
+
+    // AOC11, AOC12 : 4 rows of numbers then a row of operators, one problem per block of columns.
+    // Every problem aligns its numbers on the left or on the right, its operator sits in its first column.
+    void GenerateWorksheet(std::ostream& stream, double scale, Random& random)
+    {
+        constexpr size_t K_ROW_COUNT = 4;
+
+        size_t problemCount = GetScaledCount(1000, scale);
+        std::string rows[K_ROW_COUNT + 1];
+        for (size_t problem = 0; problem < problemCount; problem++)
+        {
+            std::string numbers[K_ROW_COUNT];
+            size_t width = 0;
+            for (std::string& number : numbers)
+            {
+                number = std::to_string(GetNumberWithDigits(random.Range(1, 4), random));
+                width = std::max(width, number.size());
+            }
+
+            bool alignLeft = random.Chance(0.5);
+            for (size_t row = 0; row < K_ROW_COUNT; row++)
+            {
+                std::string padding(width - numbers[row].size(), ' ');
+                if (problem > 0) rows[row] += ' ';
+                rows[row] += alignLeft ? numbers[row] + padding : padding + numbers[row];
+            }
+
+            if (problem > 0) rows[K_ROW_COUNT] += ' ';
+            rows[K_ROW_COUNT] += random.Chance(0.5) ? '+' : '*';
+            rows[K_ROW_COUNT] += std::string(width - 1, ' ');
+        }
+
+        for (std::string const& row : rows)
+        {
+            stream << row << '\n';
+        }
+    }
+
+    // AOC13, AOC14, AOC15 : 'S' at the top center, splitter rows every other row spreading as a triangle below it
+    void GenerateTachyonManifold(std::ostream& stream, double scale, Random& random)
+    {
+        size_t width = GetScaledSide(141, scale) | 1; // Odd, so 'S' has a center column
+        size_t height = GetScaledSide(142, scale);
+        int64_t center = static_cast<int64_t>(width / 2);
+
+        std::string row(width, '.');
+        row[center] = 'S';
+        stream << row << '\n';
+
+        for (size_t y = 1; y < height; y++)
+        {
+            std::fill(row.begin(), row.end(), '.');
+
+            // Row 2k holds up to k splitters, 2 columns apart, centered under 'S'
+            int64_t splitters = (y % 2 == 0) ? static_cast<int64_t>(y / 2) : 0;
+            for (int64_t index = 0; index < splitters; index++)
+            {
+                int64_t x = center - (splitters - 1) + 2 * index;
+                if (x < 1 || x >= static_cast<int64_t>(width) - 1) continue;
+                if (random.Chance(0.85)) row[x] = '^';
+            }
+
+            stream << row << '\n';
+        }
+    }
+
+    // AOC16, AOC17 : "x,y,z" junction boxes
+    void GenerateJunctionBoxes(std::ostream& stream, double scale, Random& random)
+    {
+        size_t count = GetScaledCount(1000, scale);
+        for (size_t index = 0; index < count; index++)
+        {
+            stream << random.Range(0, 99999) << ',' << random.Range(0, 99999) << ',' << random.Range(0, 99999) << '\n';
+        }
+    }
+
+    // AOC18, AOC19 : "x,y" corners of a closed rectilinear polygon, in order.
+    // A histogram shape : columns of random heights standing on a flat bottom, so edges never cross.
+    void GenerateRectilinearPolygon(std::ostream& stream, double scale, Random& random)
+    {
+        constexpr uint64_t K_BOTTOM = 1000;
+
+        size_t columns = std::max<size_t>(1, (GetScaledCount(496, scale) - 2) / 2);
+
+        uint64_t x = random.Range(1000, 2000);
+        uint64_t height = 0;
+        stream << x << ',' << K_BOTTOM << '\n';
+        for (size_t column = 0; column < columns; column++)
+        {
+            uint64_t next = height;
+            while (next == height) next = random.Range(K_BOTTOM + 1, 99999);
+            height = next;
+
+            stream << x << ',' << height << '\n';
+            x += random.Range(1, 800);
+            stream << x << ',' << height << '\n';
+        }
+        stream << x << ',' << K_BOTTOM << '\n';
+    }
+
+    // AOC20 : "[.##.] (0,3) (1,2) {3,5,4,7}"
+    // The lights are reachable by pressing buttons and the joltages are the result of some count of presses.
+    void GenerateMachines(std::ostream& stream, double scale, Random& random)
+    {
+        size_t count = GetScaledCount(188, scale);
+        for (size_t machine = 0; machine < count; machine++)
+        {
+            size_t lightCount = random.Range(3, 10);
+            size_t buttonCount = random.Range(2, lightCount + 3);
+
+            uint64_t lights = 0;
+            std::vector<uint64_t> joltages(lightCount, 0);
+            std::vector<uint64_t> buttons;
+            for (size_t button = 0; button < buttonCount; button++)
+            {
+                uint64_t bindings = 0;
+                while (bindings == 0) bindings = random.Range(1, (uint64_t(1) << lightCount) - 1);
+                buttons.push_back(bindings);
+
+                if (random.Chance(0.5)) lights ^= bindings;
+
+                uint64_t presses = random.Range(0, 30);
+                for (size_t light = 0; light < lightCount; light++)
+                {
+                    if (bindings & (uint64_t(1) << light)) joltages[light] += presses;
+                }
+            }
+
+            stream << '[';
+            for (size_t light = 0; light < lightCount; light++) stream << ((lights & (uint64_t(1) << light)) ? '#' : '.');
+            stream << ']';
+
+            for (uint64_t bindings : buttons)
+            {
+                stream << " (";
+                bool first = true;
+                for (size_t light = 0; light < lightCount; light++)
+                {
+                    if (!(bindings & (uint64_t(1) << light))) continue;
+                    if (!first) stream << ',';
+                    stream << light;
+                    first = false;
+                }
+                stream << ')';
+            }
+
+            stream << " {";
+            for (size_t light = 0; light < lightCount; light++)
+            {
+                if (light > 0) stream << ',';
+                stream << joltages[light];
+            }
+            stream << "}\n";
+        }
+    }
+
+    bool IsReservedDeviceName(std::string const& name)
+    {
+        return name == "svr" || name == "you" || name == "fft" || name == "dac" || name == "out";
+    }
+
+    // "aaa", "aab"... then longer names once the 3 letters ones run out
+    std::string GetDeviceName(size_t index)
+    {
+        std::string name;
+        for (size_t letter = 0; letter < 3 || index > 0; letter++)
+        {
+            name.insert(name.begin(), static_cast<char>('a' + index % 26));
+            index /= 26;
+        }
+        return name;
+    }
+
+    // AOC22, AOC23 : "abc: def ghi" device outputs, a DAG from "svr" to "out" going through "you", "fft" and "dac".
+    // Devices are laid out in layers, each one outputting to 1 to 3 devices of the next layer and getting at least
+    // one input from the previous layer : every device is on a path from "svr" to "out", and "dac" is picked among
+    // the devices "fft" leads to, so there always is a path through both.
+    // That is at most 3^(layers - 1) paths, and the layer count only grows with the log of scale, so the path
+    // counts stay within a uint64_t and AOC22 can still list them all (a few thousands at scale 1).
+    void GenerateDeviceGraph(std::ostream& stream, double scale, Random& random)
+    {
+        constexpr size_t K_MAX_OUTPUTS = 3;
+        constexpr int64_t K_MIN_LAYERS = 4;
+        constexpr int64_t K_MAX_LAYERS = 36;
+
+        size_t count = std::max<size_t>(5, GetScaledCount(560, scale));
+        int64_t scaledLayerCount = std::llround(12 + std::log2(scale));
+        size_t layerCount = std::min<size_t>(count - 1, std::clamp(scaledLayerCount, K_MIN_LAYERS, K_MAX_LAYERS));
+
+        // "svr" and "out" alone on the first and last layers, the others spread evenly over the middle ones as long
+        // as each of them can still be fed by its previous layer
+        std::vector<size_t> widths(layerCount, 1);
+        size_t remaining = count - layerCount;
+        while (remaining > 0)
+        {
+            size_t added = 0;
+            for (size_t layer = 1; layer + 1 < layerCount && remaining > 0; layer++)
+            {
+                if (widths[layer] >= widths[layer - 1] * K_MAX_OUTPUTS) continue;
+                widths[layer]++;
+                remaining--;
+                added++;
+            }
+            if (added == 0)
+            {
+                widths[layerCount - 2] += remaining;
+                remaining = 0;
+            }
+        }
+
+        std::vector<std::vector<size_t>> layers(layerCount);
+        for (size_t layer = 0, device = 0; layer < layerCount; layer++)
+        {
+            for (size_t index = 0; index < widths[layer]; index++) layers[layer].push_back(device++);
+        }
+
+        std::vector<std::string> names;
+        for (size_t index = 0; names.size() < count; index++)
+        {
+            std::string name = GetDeviceName(index);
+            if (!IsReservedDeviceName(name)) names.push_back(std::move(name));
+        }
+        Shuffle(names, random);
+
+        // At least one more device than layers, so the first middle layer holds two when "you" and "fft" share it
+        size_t youLayer = std::max<size_t>(1, layerCount / 8);
+        size_t fftLayer = std::max<size_t>(1, layerCount / 3);
+        size_t dacLayer = std::max(fftLayer + 1, 2 * layerCount / 3);
+        names[layers.front().front()] = "svr";
+        names[layers[youLayer].front()] = "you";
+        names[layers[fftLayer].back()] = "fft";
+        names[layers.back().front()] = "out";
+
+        std::vector<std::vector<size_t>> outputs(count);
+        for (size_t layer = 0; layer + 1 < layerCount; layer++)
+        {
+            std::vector<size_t> const& next = layers[layer + 1];
+            std::vector<bool> fed(next.size(), false);
+            for (size_t device : layers[layer])
+            {
+                size_t outputCount = std::min<size_t>(next.size(), random.Range(1, K_MAX_OUTPUTS));
+                while (outputs[device].size() < outputCount)
+                {
+                    size_t output = random.Range(0, next.size() - 1);
+                    if (std::find(outputs[device].begin(), outputs[device].end(), next[output]) != outputs[device].end()) continue;
+                    fed[output] = true;
+                    outputs[device].push_back(next[output]);
+                }
+            }
+
+            // Devices nobody outputs to get an input from the least busy device of the previous layer
+            for (size_t output = 0; output < next.size(); output++)
+            {
+                if (fed[output]) continue;
+                size_t device = *std::min_element(layers[layer].begin(), layers[layer].end(), [&](size_t a, size_t b)
+                {
+                    return outputs[a].size() < outputs[b].size();
+                });
+                outputs[device].push_back(next[output]);
+            }
+        }
+
+        // "dac" is one of the devices "fft" leads to, any device of a layer may be picked as they all have an output
+        std::vector<bool> reached(count, false);
+        reached[layers[fftLayer].back()] = true;
+        for (size_t layer = fftLayer; layer < dacLayer; layer++)
+        {
+            for (size_t device : layers[layer])
+            {
+                if (!reached[device]) continue;
+                for (size_t output : outputs[device]) reached[output] = true;
+            }
+        }
+        std::vector<size_t> dacs;
+        for (size_t device : layers[dacLayer])
+        {
+            if (reached[device]) dacs.push_back(device);
+        }
+        names[dacs[random.Range(0, dacs.size() - 1)]] = "dac";
+
+        std::vector<std::string> lines;
+        for (size_t device = 0; device < count; device++)
+        {
+            if (outputs[device].empty()) continue;
+
+            std::string line = names[device] + ":";
+            for (size_t output : outputs[device]) line += " " + names[output];
+            lines.push_back(std::move(line));
+        }
+        Shuffle(lines, random);
+
+        for (std::string const& line : lines)
+        {
+            stream << line << '\n';
+        }
+    }
+}
+
+std::vector<GeneratorInfo> const& GetGenerators()
+{
+    static std::vector<GeneratorInfo> const generators = {
+        { "AOC1", "Dial rotations", GenerateDialRotations },
+        { "AOC2", "Dial rotations", GenerateDialRotations },
+        { "AOC3", "ID ranges", GenerateIdRanges },
+        { "AOC4", "ID ranges", GenerateIdRanges },
+        { "AOC5", "Battery banks", GenerateBatteryBanks },
+        { "AOC6", "Battery banks", GenerateBatteryBanks },
+        { "AOC7", "Paper roll grid", GeneratePaperRolls },
+        { "AOC8", "Paper roll grid", GeneratePaperRolls },
+        { "AOC9", "Span database", GenerateSpanDatabase },
+        { "AOC10", "Span database", GenerateSpanDatabase },
+        { "AOC11", "Worksheet", GenerateWorksheet },
+        { "AOC12", "Worksheet", GenerateWorksheet },
+        { "AOC13", "Tachyon manifold", GenerateTachyonManifold },
+        { "AOC14", "Tachyon manifold", GenerateTachyonManifold },
+        { "AOC15", "Tachyon manifold", GenerateTachyonManifold },
+        { "AOC16", "3D points", GenerateJunctionBoxes },
+        { "AOC17", "3D points", GenerateJunctionBoxes },
+        { "AOC18", "Rectilinear polygon", GenerateRectilinearPolygon },
+        { "AOC19", "Rectilinear polygon", GenerateRectilinearPolygon },
+        { "AOC20", "Machines", GenerateMachines },
+        { "AOC22", "Device DAG", GenerateDeviceGraph, 2.0 }, // Lists every path, quadratically in their count
+        { "AOC23", "Device DAG", GenerateDeviceGraph },
+    };
+    return generators;
+}
+
+GeneratorInfo const* FindGenerator(std::string_view name)
+{
+    std::string normalized = NormalizeDayName(name);
+    for (GeneratorInfo const& generator : GetGenerators())
+    {
+        if (normalized == generator.Name) return &generator;
+    }
+    return nullptr;
+}
+
+void Generate(GeneratorInfo const& generator, std::ostream& stream, double scale, uint64_t seed)
+{
+    Random random(seed ^ HashFormat(generator.Format));
+    generator.Generate(stream, scale, random);
+}
+
+std::string GenerateInput(GeneratorInfo const& generator, double scale, uint64_t seed)
+{
+    std::ostringstream stream;
+    Generate(generator, stream, scale, seed);
+    return stream.str();
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// splitmix64 : the same sequence for a seed on every platform and standard library,
+// which the std distributions don't guarantee
+class Random
+{
+public:
+    explicit Random(uint64_t seed)
+        : m_State(seed)
+    {
+    }
+
+    uint64_t Next()
+    {
+        uint64_t z = (m_State += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+
+    // Uniform in [min, max]
+    uint64_t Range(uint64_t min, uint64_t max)
+    {
+        uint64_t span = max - min + 1;
+        return span == 0 ? Next() : min + Next() % span;
+    }
+
+    bool Chance(double probability)
+    {
+        return (Next() >> 11) * (1.0 / 9007199254740992.0) < probability;
+    }
+
+private:
+    uint64_t m_State;
+};
+
+// Writes a day's input. Scale multiplies the size of the real puzzle input : item count for lists,
+// cell count for grids.
+using GenerateFunction = void (*)(std::ostream& stream, double scale, Random& random);
+
+struct GeneratorInfo
+{
+    char const* Name;   // Day the input is for
+    char const* Format; // Days sharing a format get the same input for a given seed, like the real puzzles
+    GenerateFunction Generate;
+    double MaxScale = 0.0; // Largest scale aoc_bench --scaling times, past it a single run takes minutes. 0 is no limit
+};
+
+// One generator per implemented day, sorted by day
+std::vector<GeneratorInfo> const& GetGenerators();
+GeneratorInfo const* FindGenerator(std::string_view name);
+
+// Seeds from the format, so days sharing a format get the same input
+void Generate(GeneratorInfo const& generator, std::ostream& stream, double scale, uint64_t seed);
+std::string GenerateInput(GeneratorInfo const& generator, double scale, uint64_t seed);
@@ -0,0 +1,127 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Generators.h"
+
+struct Options
+{
+    std::vector<std::string> Days;
+    double Scale = 1.0;
+    uint64_t Seed = 1;
+    std::string Output;
+};
+
+void PrintUsage()
+{
+    std::cout << "Usage : aoc_gen [options]\n"
+              << "  --day <AOCn>[,<AOCn>...]  Only generate the given days (repeatable, 'n' alone is accepted)\n"
+              << "  --scale <factor>          Size relative to the real puzzle input (default 1, e.g. 1000)\n"
+              << "  --seed <N>                Same seed, same inputs (default 1)\n"
+              << "  --output <dir>            Write <dir>/AOCn/input.txt for every day, to run aoc_bench --root <dir>.\n"
+              << "                            A single day is written to stdout when omitted\n";
+}
+
+bool ParseOptions(int argc, char** argv, Options& options)
+{
+    for (int index = 1; index < argc; index++)
+    {
+        std::string arg = argv[index];
+        bool hasValue = index + 1 < argc;
+
+        if (arg == "--day" && hasValue)
+        {
+            std::string list = argv[++index];
+            size_t begin = 0;
+            while (begin <= list.size())
+            {
+                size_t end = std::min(list.find(',', begin), list.size());
+                if (end > begin) options.Days.push_back(list.substr(begin, end - begin));
+                begin = end + 1;
+            }
+        }
+        else if (arg == "--scale" && hasValue)
+        {
+            options.Scale = std::strtod(argv[++index], nullptr);
+            if (!(options.Scale > 0.0)) return false;
+        }
+        else if (arg == "--seed" && hasValue)
+        {
+            options.Seed = std::strtoull(argv[++index], nullptr, 10);
+        }
+        else if (arg == "--output" && hasValue)
+        {
+            options.Output = argv[++index];
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    Options options;
+    if (!ParseOptions(argc, argv, options))
+    {
+        PrintUsage();
+        return 1;
+    }
+
+    std::vector<GeneratorInfo const*> generators;
+    if (options.Days.empty())
+    {
+        for (GeneratorInfo const& generator : GetGenerators()) generators.push_back(&generator);
+    }
+    for (std::string const& day : options.Days)
+    {
+        if (GeneratorInfo const* generator = FindGenerator(day))
+        {
+            generators.push_back(generator);
+        }
+        else
+        {
+            std::cerr << "No generator for " << day << "\n";
+        }
+    }
+
+    if (options.Output.empty() && generators.size() != 1)
+    {
+        std::cerr << "--output is required to generate more than one day\n";
+        return 1;
+    }
+
+    for (GeneratorInfo const* generator : generators)
+    {
+        if (options.Output.empty())
+        {
+            Generate(*generator, std::cout, options.Scale, options.Seed);
+            continue;
+        }
+
+        std::filesystem::path directory = std::filesystem::path(options.Output) / generator->Name;
+        std::error_code error;
+        std::filesystem::create_directories(directory, error);
+
+        std::filesystem::path filename = directory / "input.txt";
+        std::ofstream file(filename, std::ios::binary);
+        if (!file)
+        {
+            std::cerr << "Unable to write " << filename.string() << "\n";
+            return 1;
+        }
+
+        std::cerr << "Generating " << generator->Name << " (" << generator->Format << ")...\n";
+        Generate(*generator, file, options.Scale, options.Seed);
+    }
+
+    return 0;
+}
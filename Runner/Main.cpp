@@ -0,0 +1,367 @@
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Server.h"
+#include "Common/Allocations.h"
+#include "Common/Day.h"
+#include "Common/InputFile.h"
+#include "Common/Log.h"
+#include "Common/ParseCache.h"
+#include "Common/Profile.h"
+
+struct Options
+{
+    std::vector<std::string> Days;
+    bool All = false;
+    bool Verbose = false;
+    bool Compare = false;
+    bool Heap = false;
+    bool ParseCache = true;
+    size_t Jobs = 0; // 0 : one per hardware thread
+    std::string Root = AOC_SOURCE_DIR;
+    std::string CostFile = "aoc_costs.txt";
+    std::string TraceFile;
+
+    // Warm daemon, and the client asking it for the days
+    ServerOptions Server;
+    std::string ConnectSocket;
+    bool Inline = false;
+};
+
+// Outcome of a single day, its report is buffered so parallel days never interleave their output
+struct DayRun
+{
+    DayInfo const* Info = nullptr;
+    std::string Report;
+    double ElapsedMs = 0.0;
+    bool Success = true;
+};
+
+using CostTable = std::map<std::string, double>;
+
+void PrintUsage()
+{
+    std::cout << "Usage : aoc [options] [day...]\n"
+              << "  day             AOCn or n, every day when omitted\n"
+              << "  --all           Also run the slow days when no day is given\n"
+              << "  --jobs <N>      Days run at the same time (default : one per hardware thread)\n"
+              << "  --costs <file>  Per-day costs recorded by earlier runs (default aoc_costs.txt)\n"
+              << "  --compare       Run the days a second time one by one to measure the real speedup\n"
+              << "  --heap          Show the allocations, allocated bytes and heap peak of every phase\n"
+              << "  --no-cache      Always parse the inputs, instead of loading the parsed snapshots next to them\n"
+              << "  --verbose       Show the log of every day under its report\n"
+              << "  --trace <file>  Write the profiled scopes as a Chrome trace (AOC_PROFILE builds)\n"
+              << "  --root <dir>    Repository root holding the AOCn/input.txt files\n"
+              << "  --serve <sock>  Keep running, answering solve requests on a Unix socket with the inputs kept parsed\n"
+              << "  --cache <N>     Parsed inputs the server keeps (default 64)\n"
+              << "  --connect <sock> Ask a running server for the days instead of solving them\n"
+              << "  --inline        Send the inputs to the server instead of their path\n";
+}
+
+bool ParseOptions(int argc, char** argv, Options& options)
+{
+    for (int index = 1; index < argc; index++)
+    {
+        std::string arg = argv[index];
+        bool hasValue = index + 1 < argc;
+
+        if (arg == "--all") options.All = true;
+        else if (arg == "--verbose") options.Verbose = true;
+        else if (arg == "--compare") options.Compare = true;
+        else if (arg == "--heap") options.Heap = true;
+        else if (arg == "--no-cache") options.ParseCache = false;
+        else if (arg == "--jobs" && hasValue) options.Jobs = std::strtoull(argv[++index], nullptr, 10);
+        else if (arg == "--costs" && hasValue) options.CostFile = argv[++index];
+        else if (arg == "--root" && hasValue) options.Root = argv[++index];
+        else if (arg == "--trace" && hasValue) options.TraceFile = argv[++index];
+        else if (arg == "--serve" && hasValue) options.Server.SocketPath = argv[++index];
+        else if (arg == "--cache" && hasValue) options.Server.CacheEntries = std::strtoull(argv[++index], nullptr, 10);
+        else if (arg == "--connect" && hasValue) options.ConnectSocket = argv[++index];
+        else if (arg == "--inline") options.Inline = true;
+        else if (!arg.empty() && arg.front() != '-') options.Days.push_back(arg);
+        else return false;
+    }
+
+    return true;
+}
+
+CostTable LoadCosts(std::string const& filename)
+{
+    CostTable costs;
+
+    std::ifstream stream(filename);
+    std::string name;
+    double milliseconds;
+    while (stream >> name >> milliseconds)
+    {
+        costs[name] = milliseconds;
+    }
+
+    return costs;
+}
+
+void SaveCosts(std::string const& filename, CostTable const& costs)
+{
+    std::ofstream stream(filename);
+    for (auto const& [name, milliseconds] : costs)
+    {
+        stream << name << ' ' << milliseconds << '\n';
+    }
+}
+
+double ElapsedMs(std::chrono::steady_clock::time_point begin, std::chrono::steady_clock::time_point end)
+{
+    return std::chrono::duration<double, std::milli>(end - begin).count();
+}
+
+DayRun Execute(Options const& options, DayInfo const& info)
+{
+    using Clock = std::chrono::steady_clock;
+
+    DayRun run;
+    run.Info = &info;
+
+    std::ostringstream report;
+    report << std::fixed << std::setprecision(3);
+
+    if (info.IsPlaceholder())
+    {
+        report << std::left << std::setw(7) << info.Name << "not implemented\n";
+        run.Report = report.str();
+        return run;
+    }
+
+    auto begin = Clock::now();
+
+    std::string filename = GetDayInputPath(options.Root, info);
+    InputFile file(filename);
+    if (!file.IsOpen())
+    {
+        report << std::left << std::setw(7) << info.Name << "unable to open " << filename << "\n";
+        run.Report = report.str();
+        run.Success = false;
+        return run;
+    }
+
+    std::optional<std::string> answers[2];
+    Clock::time_point times[4];
+    AllocationStats heap[3];
+
+    // Each day logs under its own report, even when running alongside others
+    std::ostringstream log;
+    if (options.Verbose) Log::SetThreadOutput(&log);
+
+    std::unique_ptr<Day> day = info.Create();
+    bool cached = false;
+    times[0] = Clock::now();
+    {
+        AOC_PROFILE_SCOPE(info.Name + " Parse");
+        AllocationScope allocations;
+        if (options.ParseCache) cached = ParseCached(day, info, file.GetData(), GetParseCachePath(filename, info));
+        else day->Parse(file.GetData());
+        heap[0] = allocations.GetStats();
+    }
+    times[1] = Clock::now();
+    {
+        AOC_PROFILE_SCOPE(info.Name + " Part1");
+        AllocationScope allocations;
+        answers[0] = day->Part1();
+        heap[1] = allocations.GetStats();
+    }
+    times[2] = Clock::now();
+    {
+        AOC_PROFILE_SCOPE(info.Name + " Part2");
+        AllocationScope allocations;
+        answers[1] = day->Part2();
+        heap[2] = allocations.GetStats();
+    }
+    times[3] = Clock::now();
+
+    if (options.Verbose)
+    {
+        Log::Flush();
+        Log::SetThreadOutput(nullptr);
+    }
+
+    auto writeHeap = [&](AllocationStats const& stats)
+    {
+        if (!options.Heap) return;
+        report << std::setw(10) << stats.Counters.Count << " allocs" << std::setw(12) << stats.Counters.Bytes << " B"
+               << "  peak" << std::setw(12) << stats.PeakBytes << " B";
+    };
+
+    report << std::left << std::setw(7) << info.Name << "parse " << std::right << std::setw(10) << ElapsedMs(times[0], times[1]) << "ms";
+    writeHeap(heap[0]);
+    if (cached) report << "  (cached)";
+    report << "\n";
+    for (size_t part = 0; part < 2; part++)
+    {
+        if (!answers[part]) continue;
+        report << std::setw(7) << "" << "part" << (part + 1) << " " << std::setw(10) << ElapsedMs(times[part + 1], times[part + 2]) << "ms";
+        writeHeap(heap[part + 1]);
+        report << "  " << *answers[part] << "\n";
+    }
+    report << log.str();
+
+    run.ElapsedMs = ElapsedMs(begin, Clock::now());
+    run.Report = report.str();
+    return run;
+}
+
+// Longest Processing Time first : the costliest days start first so the short ones fill the gaps at the end.
+// Days without a recorded cost are treated as the costliest, they could be anything.
+std::vector<size_t> ScheduleByCost(std::vector<DayInfo const*> const& days, CostTable const& costs)
+{
+    auto getCost = [&costs](DayInfo const* day)
+    {
+        auto it = costs.find(day->Name);
+        return it != costs.end() ? it->second : std::numeric_limits<double>::infinity();
+    };
+
+    std::vector<size_t> order(days.size());
+    for (size_t index = 0; index < order.size(); index++) order.at(index) = index;
+
+    std::stable_sort(order.begin(), order.end(), [&](size_t l, size_t r)
+    {
+        return getCost(days.at(l)) > getCost(days.at(r));
+    });
+
+    return order;
+}
+
+std::vector<DayRun> ExecuteAll(Options const& options, std::vector<DayInfo const*> const& days, CostTable const& costs, size_t jobs)
+{
+    std::vector<DayRun> runs(days.size());
+    std::vector<size_t> order = ScheduleByCost(days, costs);
+    jobs = std::min(jobs, days.size());
+
+    std::atomic<size_t> next{ 0 };
+    auto worker = [&]()
+    {
+        for (size_t slot = next++; slot < order.size(); slot = next++)
+        {
+            size_t index = order.at(slot);
+            runs.at(index) = Execute(options, *days.at(index));
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (size_t index = 1; index < jobs; index++)
+    {
+        threads.emplace_back(worker);
+    }
+    worker();
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    return runs;
+}
+
+int main(int argc, char** argv)
+{
+    Options options;
+    if (!ParseOptions(argc, argv, options))
+    {
+        PrintUsage();
+        return 1;
+    }
+
+    if (!options.Server.SocketPath.empty())
+    {
+        return RunServer(options.Server);
+    }
+
+    std::vector<DayInfo const*> days = DayRegistry::Get().Select(options.Days, options.All);
+    if (!options.ConnectSocket.empty())
+    {
+        return RunClient(options.ConnectSocket, days, options.Root, options.Inline);
+    }
+
+    CostTable costs = LoadCosts(options.CostFile);
+
+    size_t jobs = options.Jobs ? options.Jobs : std::max(1u, std::thread::hardware_concurrency());
+
+    std::vector<DayRun> runs;
+    std::vector<DayRun> sequentialRuns;
+    double makespanMs = 0.0;
+    double sequentialMs = 0.0;
+    {
+        // Verbose runs redirect the log of each day to its report, the rest is dropped
+        Log::SetOutput(nullptr);
+
+        auto begin = std::chrono::steady_clock::now();
+        runs = ExecuteAll(options, days, costs, jobs);
+        auto end = std::chrono::steady_clock::now();
+        makespanMs = ElapsedMs(begin, end);
+
+        if (options.Compare)
+        {
+            begin = std::chrono::steady_clock::now();
+            sequentialRuns = ExecuteAll(options, days, costs, 1);
+            end = std::chrono::steady_clock::now();
+            sequentialMs = ElapsedMs(begin, end);
+        }
+    }
+
+    bool success = true;
+    double busyMs = 0.0;
+    for (DayRun const& run : runs)
+    {
+        std::cout << run.Report;
+        success &= run.Success;
+        busyMs += run.ElapsedMs;
+    }
+
+    // Days running alone give the most faithful costs, they are only contended by each other in parallel
+    for (DayRun const& run : sequentialRuns.empty() ? runs : sequentialRuns)
+    {
+        if (run.Success && !run.Info->IsPlaceholder())
+        {
+            costs[run.Info->Name] = run.ElapsedMs;
+        }
+    }
+
+    SaveCosts(options.CostFile, costs);
+
+    if (!Profile::IsEmpty())
+    {
+        Profile::WriteSummary(std::cout);
+    }
+
+    if (!options.TraceFile.empty())
+    {
+        std::ofstream trace(options.TraceFile);
+        if (!Profile::IsCompiled()) std::cerr << "Profiling is compiled out, configure with -DAOC_PROFILE=ON\n";
+        if (trace) Profile::WriteChromeTrace(trace);
+        else std::cerr << "Unable to write " << options.TraceFile << "\n";
+    }
+
+    std::cout << std::fixed << std::setprecision(3)
+              << "Jobs : " << std::min(jobs, days.size()) << "\n"
+              << "Makespan : " << makespanMs << "ms\n"
+              << "Busy : " << busyMs << "ms (sum of every day)\n";
+    if (options.Compare)
+    {
+        std::cout << "Sequential : " << sequentialMs << "ms\n"
+                  << "Speedup : " << (makespanMs > 0.0 ? sequentialMs / makespanMs : 0.0) << "x\n";
+    }
+
+    return success ? 0 : 1;
+}
@@ -0,0 +1,592 @@
+#include "Server.h"
+
+#include <iostream>
+
+#ifdef _WIN32
+
+int RunServer(ServerOptions const&)
+{
+    std::cerr << "aoc --serve needs Unix domain sockets, it isn't available on Windows\n";
+    return 1;
+}
+
+int RunClient(std::string const&, std::vector<DayInfo const*> const&, std::string const&, bool)
+{
+    std::cerr << "aoc --connect needs Unix domain sockets, it isn't available on Windows\n";
+    return 1;
+}
+
+#else
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <filesystem>
+#include <iomanip>
+#include <list>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <string_view>
+
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "Common/InputFile.h"
+#include "Common/Log.h"
+#include "Common/Scanner.h"
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    // A request line longer than this is garbage, the connection is dropped
+    constexpr size_t K_MAX_REQUEST_LINE = 4096;
+    constexpr size_t K_MAX_PAYLOAD_SIZE = 256 * 1024 * 1024; // Larger inline inputs are refused, the client is disconnected
+    constexpr size_t K_RECEIVE_SIZE = 64 * 1024;
+
+    volatile std::sig_atomic_t g_Stop = 0;
+
+    void OnStopSignal(int)
+    {
+        g_Stop = 1;
+    }
+
+    uint64_t HashPayload(std::string_view payload)
+    {
+        // FNV-1a
+        uint64_t hash = 14695981039346656037ull;
+        for (char c : payload)
+        {
+            hash ^= static_cast<uint8_t>(c);
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+
+    bool SendAll(int socket, std::string_view data)
+    {
+        while (!data.empty())
+        {
+            ssize_t sent = send(socket, data.data(), data.size(), MSG_NOSIGNAL);
+            if (sent < 0 && errno == EINTR) continue;
+            if (sent <= 0) return false;
+            data.remove_prefix(static_cast<size_t>(sent));
+        }
+        return true;
+    }
+
+    bool MakeAddress(std::string const& path, sockaddr_un& address)
+    {
+        address = {};
+        address.sun_family = AF_UNIX;
+        if (path.empty() || path.size() >= sizeof(address.sun_path)) return false;
+        std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+        return true;
+    }
+
+    int Connect(std::string const& path)
+    {
+        sockaddr_un address;
+        if (!MakeAddress(path, address)) return -1;
+
+        int socket = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if (socket < 0) return -1;
+        if (connect(socket, reinterpret_cast<sockaddr const*>(&address), sizeof(address)) < 0)
+        {
+            close(socket);
+            return -1;
+        }
+        return socket;
+    }
+
+    enum class RequestKind
+    {
+        File,
+        Inline,
+        Shutdown
+    };
+
+    struct Request
+    {
+        RequestKind Kind = RequestKind::File;
+        std::string_view Day;
+        uint32_t Part = 0;
+        std::string_view Path; // File requests
+        size_t PayloadSize = 0; // Inline requests, also set when the rest of their line is invalid
+    };
+
+    enum class ParseStatus
+    {
+        Valid,
+        Invalid,      // Answered with an error, the request's payload is skipped
+        Unrecoverable // Answered with an error then disconnected, the payload can't be told apart from the next request
+    };
+
+    // "<day> <part> file <path>", "<day> <part> inline <size>" or "shutdown"
+    ParseStatus ParseRequest(std::string_view line, Request& request, std::string& error)
+    {
+        if (line == "shutdown")
+        {
+            request.Kind = RequestKind::Shutdown;
+            return ParseStatus::Valid;
+        }
+
+        Tokenizer fields(line, ' ');
+        std::string_view part, kind;
+        if (!fields.Next(request.Day) || !fields.Next(part) || !fields.Next(kind))
+        {
+            error = "expected <day> <part> file <path> or <day> <part> inline <size>";
+            return ParseStatus::Invalid;
+        }
+
+        // The payload size first, whatever else is wrong the payload has to be skipped
+        if (kind == "inline")
+        {
+            std::string_view size = fields.GetRemaining();
+            request.Kind = RequestKind::Inline;
+            request.PayloadSize = ParseInteger<size_t>(size);
+            if (request.PayloadSize == 0 && size != "0")
+            {
+                error = "invalid payload size " + std::string(size);
+                return ParseStatus::Unrecoverable;
+            }
+            if (request.PayloadSize > K_MAX_PAYLOAD_SIZE)
+            {
+                error = "payload of " + std::string(size) + " bytes over the " + std::to_string(K_MAX_PAYLOAD_SIZE) + " bytes limit";
+                return ParseStatus::Unrecoverable;
+            }
+        }
+
+        request.Part = ParseInteger<uint32_t>(part);
+        if (request.Part != 1 && request.Part != 2)
+        {
+            error = "part must be 1 or 2, not " + std::string(part);
+            return ParseStatus::Invalid;
+        }
+
+        if (kind == "file")
+        {
+            // The rest of the line, paths may hold spaces
+            request.Kind = RequestKind::File;
+            request.Path = fields.GetRemaining();
+            if (request.Path.empty())
+            {
+                error = "missing input path";
+                return ParseStatus::Invalid;
+            }
+            return ParseStatus::Valid;
+        }
+
+        if (kind == "inline") return ParseStatus::Valid;
+
+        error = "unknown input kind " + std::string(kind) + ", expected file or inline";
+        return ParseStatus::Invalid;
+    }
+
+    // A parsed input, the Day keeps views into its File or Payload
+    struct WarmInput
+    {
+        std::string Key;
+        InputFile File;
+        std::string Payload;
+        std::unique_ptr<Day> Solution;
+        uint64_t ParseNs = 0;
+    };
+
+    // Least recently used inputs are dropped first. Entries never move once created, the views into them stay valid.
+    class WarmCache
+    {
+    public:
+        explicit WarmCache(size_t capacity)
+            : m_Capacity(std::max<size_t>(1, capacity))
+        {
+        }
+
+        WarmInput* Find(std::string const& key)
+        {
+            auto it = std::find_if(m_Entries.begin(), m_Entries.end(), [&key](WarmInput const& entry) { return entry.Key == key; });
+            if (it == m_Entries.end()) return nullptr;
+
+            m_Entries.splice(m_Entries.begin(), m_Entries, it);
+            return &m_Entries.front();
+        }
+
+        WarmInput& Create(std::string const& key)
+        {
+            if (m_Entries.size() >= m_Capacity) m_Entries.pop_back();
+
+            WarmInput& entry = m_Entries.emplace_front();
+            entry.Key = key;
+            return entry;
+        }
+
+        void Erase(std::string const& key)
+        {
+            m_Entries.remove_if([&key](WarmInput const& entry) { return entry.Key == key; });
+        }
+
+    private:
+        std::list<WarmInput> m_Entries; // Most recently used first
+        size_t m_Capacity;
+    };
+
+    class Server
+    {
+    public:
+        explicit Server(ServerOptions const& options)
+            : m_Cache(options.CacheEntries)
+        {
+        }
+
+        // Answers every complete request received on the connection, false once it has to be closed
+        bool ProcessRequests(int socket, std::string& received);
+
+        bool IsShuttingDown() const { return m_ShuttingDown; }
+
+    private:
+        std::string Solve(Request const& request, std::string_view payload);
+        std::string SolveWarm(Request const& request, std::string_view payload);
+
+        WarmCache m_Cache;
+        bool m_ShuttingDown = false;
+    };
+
+    bool Server::ProcessRequests(int socket, std::string& received)
+    {
+        std::string_view pending(received);
+        std::string responses;
+        bool keepOpen = true;
+
+        while (!m_ShuttingDown)
+        {
+            size_t lineEnd = pending.find('\n');
+            if (lineEnd == std::string_view::npos)
+            {
+                if (pending.size() > K_MAX_REQUEST_LINE)
+                {
+                    responses += "error request line too long\n";
+                    keepOpen = false;
+                }
+                break;
+            }
+
+            std::string_view line = pending.substr(0, lineEnd);
+            if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+
+            Request request;
+            std::string error;
+            ParseStatus status = ParseRequest(line, request, error);
+            if (status == ParseStatus::Unrecoverable)
+            {
+                responses += "error " + error + "\n";
+                pending = {};
+                keepOpen = false;
+                break;
+            }
+
+            if (status == ParseStatus::Valid && request.Kind == RequestKind::Shutdown)
+            {
+                responses += "ok shutdown\n";
+                m_ShuttingDown = true;
+                break;
+            }
+
+            // Waits for the whole payload, even to skip it
+            size_t requestSize = lineEnd + 1 + (request.Kind == RequestKind::Inline ? request.PayloadSize : 0);
+            if (pending.size() < requestSize) break;
+
+            if (status == ParseStatus::Valid)
+            {
+                responses += Solve(request, pending.substr(lineEnd + 1, requestSize - lineEnd - 1));
+            }
+            else
+            {
+                responses += "error " + error + "\n";
+            }
+            pending.remove_prefix(requestSize);
+        }
+
+        received.erase(0, received.size() - pending.size());
+        return SendAll(socket, responses) && keepOpen;
+    }
+
+    std::string Server::Solve(Request const& request, std::string_view payload)
+    {
+        try
+        {
+            return SolveWarm(request, payload);
+        }
+        catch (std::exception const& exception)
+        {
+            return std::string("error ") + exception.what() + "\n";
+        }
+    }
+
+    std::string Server::SolveWarm(Request const& request, std::string_view payload)
+    {
+        DayInfo const* info = DayRegistry::Get().Find(request.Day);
+        if (info == nullptr) return "error unknown day " + std::string(request.Day) + "\n";
+        if (info->IsPlaceholder()) return "error " + info->Name + " is not implemented yet\n";
+
+        // Files are told apart by their modification time and size as well, an edited input is parsed again
+        std::ostringstream key;
+        if (request.Kind == RequestKind::File)
+        {
+            std::error_code error;
+            std::filesystem::path path(request.Path);
+            auto modified = std::filesystem::last_write_time(path, error);
+            uintmax_t size = std::filesystem::file_size(path, error);
+            if (error) return "error unable to open " + std::string(request.Path) + "\n";
+            key << info->Name << " file " << modified.time_since_epoch().count() << ' ' << size << ' ' << request.Path;
+        }
+        else
+        {
+            key << info->Name << " inline " << HashPayload(payload) << ' ' << payload.size();
+        }
+
+        WarmInput* input = m_Cache.Find(key.str());
+        if (input != nullptr && request.Kind == RequestKind::Inline && input->Payload != payload)
+        {
+            // Hash collision
+            m_Cache.Erase(key.str());
+            input = nullptr;
+        }
+
+        bool cached = input != nullptr;
+        if (!cached)
+        {
+            WarmInput& fresh = m_Cache.Create(key.str());
+            std::string_view data;
+            if (request.Kind == RequestKind::File)
+            {
+                if (!fresh.File.Open(std::string(request.Path)))
+                {
+                    m_Cache.Erase(key.str());
+                    return "error unable to open " + std::string(request.Path) + "\n";
+                }
+                data = fresh.File.GetData();
+            }
+            else
+            {
+                fresh.Payload.assign(payload);
+                data = fresh.Payload;
+            }
+
+            fresh.Solution = info->Create();
+            Clock::time_point begin = Clock::now();
+            try
+            {
+                fresh.Solution->Parse(data);
+            }
+            catch (...)
+            {
+                m_Cache.Erase(key.str());
+                throw;
+            }
+            fresh.ParseNs = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - begin).count();
+            input = &fresh;
+        }
+
+        Clock::time_point begin = Clock::now();
+        std::optional<std::string> answer = request.Part == 1 ? input->Solution->Part1() : input->Solution->Part2();
+        uint64_t solveNs = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - begin).count();
+
+        if (!answer) return "error " + info->Name + " part " + std::to_string(request.Part) + " is not implemented\n";
+
+        std::ostringstream response;
+        response << "ok " << (cached ? 1 : 0) << ' ' << input->ParseNs << ' ' << solveNs << ' ' << *answer << '\n';
+        return response.str();
+    }
+
+    int Listen(std::string const& path)
+    {
+        sockaddr_un address;
+        if (!MakeAddress(path, address))
+        {
+            std::cerr << "Invalid socket path " << path << "\n";
+            return -1;
+        }
+
+        // A socket file left behind by a server that didn't exit cleanly is replaced, a live one is not
+        int existing = Connect(path);
+        if (existing >= 0)
+        {
+            close(existing);
+            std::cerr << "A server is already listening on " << path << "\n";
+            return -1;
+        }
+        unlink(path.c_str());
+
+        int socket = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if (socket < 0 || bind(socket, reinterpret_cast<sockaddr const*>(&address), sizeof(address)) < 0 || listen(socket, SOMAXCONN) < 0)
+        {
+            std::cerr << "Unable to listen on " << path << " : " << std::strerror(errno) << "\n";
+            if (socket >= 0) close(socket);
+            return -1;
+        }
+        return socket;
+    }
+}
+
+int RunServer(ServerOptions const& options)
+{
+    int listener = Listen(options.SocketPath);
+    if (listener < 0) return 1;
+
+    // No SA_RESTART : poll returns on the signal and the loop sees g_Stop
+    struct sigaction action = {};
+    action.sa_handler = OnStopSignal;
+    sigaction(SIGINT, &action, nullptr);
+    sigaction(SIGTERM, &action, nullptr);
+
+    // Only the answers are sent back, the days' logs are dropped
+    Log::SetOutput(nullptr);
+
+    std::cerr << "Serving on " << options.SocketPath << "\n";
+
+    struct Connection
+    {
+        int Socket;
+        std::string Received;
+    };
+
+    Server server(options);
+    std::vector<Connection> connections;
+    std::vector<pollfd> polled;
+    std::string buffer(K_RECEIVE_SIZE, '\0');
+    while (!g_Stop && !server.IsShuttingDown())
+    {
+        polled.clear();
+        polled.push_back({ listener, POLLIN, 0 });
+        for (Connection const& connection : connections) polled.push_back({ connection.Socket, POLLIN, 0 });
+
+        if (poll(polled.data(), polled.size(), -1) < 0)
+        {
+            if (errno == EINTR) continue;
+            std::cerr << "poll : " << std::strerror(errno) << "\n";
+            break;
+        }
+
+        // Connections first, the indices of polled match them before any is added or removed
+        for (size_t index = connections.size(); index-- > 0;)
+        {
+            if (polled[index + 1].revents == 0) continue;
+
+            Connection& connection = connections[index];
+            ssize_t size = recv(connection.Socket, buffer.data(), buffer.size(), 0);
+            if (size < 0 && errno == EINTR) continue;
+
+            bool keepOpen = size > 0;
+            if (keepOpen)
+            {
+                connection.Received.append(buffer.data(), static_cast<size_t>(size));
+                keepOpen = server.ProcessRequests(connection.Socket, connection.Received);
+            }
+
+            if (!keepOpen)
+            {
+                close(connection.Socket);
+                connections.erase(connections.begin() + index);
+            }
+        }
+
+        if (polled[0].revents & POLLIN)
+        {
+            int socket = accept(listener, nullptr, nullptr);
+            if (socket >= 0) connections.push_back({ socket, {} });
+        }
+    }
+
+    for (Connection const& connection : connections) close(connection.Socket);
+    close(listener);
+    unlink(options.SocketPath.c_str());
+    return 0;
+}
+
+int RunClient(std::string const& socketPath, std::vector<DayInfo const*> const& days, std::string const& root, bool sendInline)
+{
+    int socket = Connect(socketPath);
+    if (socket < 0)
+    {
+        std::cerr << "Unable to connect to " << socketPath << "\n";
+        return 1;
+    }
+
+    std::string received;
+    auto receiveLine = [&](std::string& line)
+    {
+        size_t lineEnd;
+        while ((lineEnd = received.find('\n')) == std::string::npos)
+        {
+            char buffer[4096];
+            ssize_t size = recv(socket, buffer, sizeof(buffer), 0);
+            if (size < 0 && errno == EINTR) continue;
+            if (size <= 0) return false;
+            received.append(buffer, static_cast<size_t>(size));
+        }
+
+        line = received.substr(0, lineEnd);
+        received.erase(0, lineEnd + 1);
+        return true;
+    };
+
+    bool success = true;
+    std::cout << std::fixed << std::setprecision(3);
+    for (DayInfo const* day : days)
+    {
+        if (day->IsPlaceholder()) continue;
+
+        std::string filename = GetDayInputPath(root, *day);
+        InputFile file;
+        if (sendInline && !file.Open(filename))
+        {
+            std::cerr << "Unable to open " << filename << "\n";
+            success = false;
+            continue;
+        }
+
+        for (uint32_t part = 1; part <= 2; part++)
+        {
+            std::ostringstream request;
+            request << day->Name << ' ' << part;
+            if (sendInline) request << " inline " << file.GetSize() << '\n' << file.GetData();
+            else request << " file " << filename << '\n';
+
+            std::string response;
+            if (!SendAll(socket, request.str()) || !receiveLine(response))
+            {
+                std::cerr << "Connection to " << socketPath << " lost\n";
+                close(socket);
+                return 1;
+            }
+
+            // ok <cached> <parse ns> <solve ns> <answer>
+            Tokenizer fields(response, ' ');
+            std::string_view status, cached, parseNs, solveNs;
+            if (!fields.Next(status) || status != "ok" || !fields.Next(cached) || !fields.Next(parseNs) || !fields.Next(solveNs))
+            {
+                // Unimplemented parts are expected, anything else is a failure
+                bool missingPart = response.find("is not implemented") != std::string::npos;
+                if (!missingPart) std::cerr << day->Name << " part" << part << " : " << response << "\n";
+                success &= missingPart;
+                continue;
+            }
+
+            std::cout << std::left << std::setw(7) << (part == 1 ? day->Name : "") << "part" << part << std::right
+                      << std::setw(10) << ParseInteger<uint64_t>(solveNs) * 1e-6 << "ms  " << fields.GetRemaining()
+                      << (cached == "1" ? "" : "  (parsed in " + std::to_string(ParseInteger<uint64_t>(parseNs) / 1000) + "us)") << "\n";
+        }
+    }
+
+    close(socket);
+    return success ? 0 : 1;
+}
+
+#endif
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "Common/Day.h"
+
+// Long-running mode of aoc : parsed inputs stay warm between requests, served over a Unix domain socket.
+// A connection sends any number of requests, one per line, and gets one line back for each of them :
+//   <day> <part> file <path>\n              Input read from a file, parsed again once the file changed
+//   <day> <part> inline <size>\n<payload>   Input of <size> bytes sent right after the line
+//   shutdown\n                              Stops the server
+// ->
+//   ok <cached> <parse ns> <solve ns> <answer>\n   cached is 1 when the input was already parsed, parse ns is then
+//                                                 the time of that first parse
+//   error <message>\n
+// A request that can't be answered gets an error, an inline one's payload is skipped all the same. An inline size that
+// can't be read or is over 256 MiB gets an error, then the connection is closed.
+// Requests are answered one at a time on the server's thread, whichever connection they come from : a slow day
+// (AOC19, AOC22) holds every other client until it is solved. The days' own parallel loops still use the thread pool.
+struct ServerOptions
+{
+    std::string SocketPath;
+    size_t CacheEntries = 64; // Parsed inputs kept warm, the least recently used one goes first
+};
+
+int RunServer(ServerOptions const& options);
+
+// Asks a running server for both parts of every day, sending the inputs inline instead of their path when asked to
+int RunClient(std::string const& socketPath, std::vector<DayInfo const*> const& days, std::string const& root, bool sendInline);